@@ -16,6 +16,13 @@
 */
 #pragma once
 
+/*!
+*   \def NDK_PREVIEW_API
+*   \brief Enables the declarations of the preview API (functions and data types).
+*   \details The preview functions are not exported yet by the SFSDK.dll and the import libraries shipped in lib/ (their ordinals are reserved, commented out, in SFSDK.Def).
+*            Define NDK_PREVIEW_API only when building against a SFSDK.dll release that exports them; otherwise, the calls fail to link.
+*/
+
 extern "C"
 {
 
@@ -172,6 +179,18 @@ extern "C"
     XCF_KENDALL=3       ///< Kendall
   }CORRELATION_METHOD;
 
+#ifdef NDK_PREVIEW_API
+/*!
+  * \brief Supported missing values (NaN) handling policies of the correlation matrix
+  * \sa NDK_CORR_MATRIX()
+  */
+  typedef enum 
+  {
+    CORR_MISSING_PAIRWISE=1,  ///< Pairwise deletion: each coefficient uses all the rows where both series are available
+    CORR_MISSING_LISTWISE=2   ///< Listwise deletion: all coefficients use only the rows where every series is available
+  }CORR_MISSING_POLICY;
+#endif // NDK_PREVIEW_API
+
 
   /*!
   * \brief Supported Link function
@@ -288,7 +307,292 @@ extern "C"
     X11_SEASONALMA_MSR=7               ///< X-11-ARIMA88
   }X11_SEASONALMA_TYPE;
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Strided view over a caller-owned two dimensional array of doubles (no copy is made)
+  *   \details The element in the i-th row and j-th column is located at pData[i*rowStride + j*colStride]:
+  *     - column-major (e.g. Fortran, Arrow/NumPy "F" order) with leading dimension ld: rowStride=1, colStride=ld.
+  *     - row-major (e.g. C, NumPy "C" order) with leading dimension ld: rowStride=ld, colStride=1.
+  *   \note 1. When rowStride is one, each column is traversed as a contiguous vector.
+  *   \note 2. The functions that only take a single observation (e.g. the target vector of NDK_GLM_FORE()) have no view variant.
+  *   \sa NDK_SARIMAX_PARAM_VIEW(), NDK_MLR_PARAM_VIEW(), NDK_PCR_PARAM_VIEW(), NDK_PCA_COMP_VIEW(), NDK_GLM_PARAM_VIEW()
+  */
+  typedef struct __MATRIX_VIEW__
+  {
+    double*   pData;      ///< is the address of the first element (i.e. first row, first column).
+    size_t    nRows;      ///< is the number of rows (i.e. observations) in the view.
+    size_t    nCols;      ///< is the number of columns (i.e. variables or factors) in the view.
+    ptrdiff_t rowStride;  ///< is the distance (in elements, not bytes) between two consecutive rows.
+    ptrdiff_t colStride;  ///< is the distance (in elements, not bytes) between two consecutive columns.
+  }MATRIX_VIEW;
+
+
+
+  /*!
+  * \brief Supported forecast error (accuracy) measures
+  * \sa NDK_BACKTEST(), NDK_RMSE(), NDK_MASE()
+  */
+  typedef enum
+  {
+    FORECAST_ERR_SSE=1,     ///<  Sum of squared errors (see NDK_SSE())
+    FORECAST_ERR_SAD=2,     ///<  Sum of absolute errors (see NDK_SAD())
+    FORECAST_ERR_MAE=3,     ///<  Mean absolute error (see NDK_MAE())
+    FORECAST_ERR_MSE=4,     ///<  Mean squared error (see NDK_MSE())
+    FORECAST_ERR_RMSE=5,    ///<  Root mean squared error (see NDK_RMSE())
+    FORECAST_ERR_MAPE=6,    ///<  Mean absolute percentage error (see NDK_MAPE())
+    FORECAST_ERR_SMAPE=7,   ///<  Symmetric mean absolute percentage error (see NDK_MAPE())
+    FORECAST_ERR_MdAPE=8,   ///<  Median absolute percentage error (see NDK_MdAPE())
+    FORECAST_ERR_MAAPE=9,   ///<  Mean arctangent absolute percentage error (see NDK_MAAPE())
+    FORECAST_ERR_MASE=10,   ///<  Mean absolute scaled error (see NDK_MASE())
+    FORECAST_ERR_MRAE=11,   ///<  Mean relative absolute error (see NDK_MRAE())
+    FORECAST_ERR_MdRAE=12,  ///<  Median relative absolute error (see NDK_MdRAE())
+    FORECAST_ERR_GMRAE=13,  ///<  Geometric mean relative absolute error (see NDK_GMRAE())
+    FORECAST_ERR_GMSE=14,   ///<  Geometric mean squared error (see NDK_GMSE())
+    FORECAST_ERR_GRMSE=15   ///<  Geometric root mean squared error (see NDK_GRMSE())
+  }FORECAST_ERROR_FUNC;
+
+  /*!
+  * \brief Supported model families in the rolling-origin backtest
+  * \sa NDK_BACKTEST()
+  */
+  typedef enum
+  {
+    BACKTEST_ARMA=1,      ///<  ARMA(p,q) (see NDK_ARMA_PARAM())
+    BACKTEST_ARIMA=2,     ///<  ARIMA(p,d,q) (see NDK_ARIMA_PARAM())
+    BACKTEST_SARIMA=3,    ///<  SARIMA(p,d,q)(P,D,Q)s (see NDK_SARIMA_PARAM())
+    BACKTEST_AIRLINE=4,   ///<  Airline (0,1,1)(0,1,1)s model (see NDK_AIRLINE_PARAM())
+    BACKTEST_GARCH=5,     ///<  GARCH(p,q) (see NDK_GARCH_PARAM())
+    BACKTEST_EGARCH=6,    ///<  EGARCH(p,q) (see NDK_EGARCH_PARAM())
+    BACKTEST_GARCHM=7     ///<  GARCH-M(p,q) (see NDK_GARCHM_PARAM())
+  }BACKTEST_MODEL_TYPE;
+
+  /*!
+  * \brief Estimation window schemes in the rolling-origin backtest
+  * \sa NDK_BACKTEST()
+  */
+  typedef enum
+  {
+    BACKTEST_EXPANDING=1, ///<  Expanding window: every origin is fitted on all observations up to (and including) the origin
+    BACKTEST_ROLLING=2    ///<  Rolling window: every origin is fitted on a fixed number (nWindow) of the most recent observations
+  }BACKTEST_WINDOW_TYPE;
+
+  /*!
+  *
+  *   \brief Data structure to capture the rolling-origin backtest options
+  *   \sa NDK_BACKTEST()
+  */
+  typedef struct __BACKTEST_OPTIONS__
+  {
+    // Model section
+    BACKTEST_MODEL_TYPE   model;        ///< is the model family to backtest (see #BACKTEST_MODEL_TYPE).
+    size_t  p;                          ///< is the order of the non-seasonal AR component (ARCH order for the GARCH family).
+    size_t  q;                          ///< is the order of the non-seasonal MA component (GARCH order for the GARCH family).
+    WORD    nIntegral;                  ///< is the non-seasonal difference order (ARIMA and SARIMA only).
+    WORD    nSIntegral;                 ///< is the seasonal difference order (SARIMA only).
+    WORD    nSPeriod;                   ///< is the number of observations per one period (SARIMA and Airline). It is also used as the seasonal period of the scaled error measures (e.g. MASE).
+    size_t  sP;                         ///< is the order of the seasonal AR component (SARIMA only).
+    size_t  sQ;                         ///< is the order of the seasonal MA component (SARIMA only).
+    WORD    nInnovationType;            ///< is the probability distribution function of the innovations (GARCH family only, see #INNOVATION_TYPE).
+
+    // Window section
+    BACKTEST_WINDOW_TYPE  window;       ///< is the estimation window scheme (see #BACKTEST_WINDOW_TYPE).
+    size_t  nWindow;                    ///< is the number of observations in the first estimation window (also the window length for a rolling window).
+    size_t  nStride;                    ///< is the number of observations between two consecutive forecast origins (1 = every observation).
+    size_t  nRefit;                     ///< is the number of origins between two calibrations (1 = refit at every origin). In between, the last calibrated parameters are reused as-is.
+    BOOL    bWarmStart;                 ///< is a switch to start every calibration from the previously calibrated parameters, instead of the quick guess.
+
+    // Forecast and calibration section
+    size_t  nHorizon;                   ///< is the number of out-of-sample steps forecasted (and scored) at every origin.
+    size_t  maxIter;                    ///< is the maximum number of iterations used to calibrate the model. If missing or less than 100, the default maximum of 100 is assumed.
+    size_t  nThreads;                   ///< is the maximum number of worker threads used to evaluate the origins (0 = one per logical processor).
+  }BACKTEST_OPTIONS;
+
+  /*!
+  * \ingroup statistical testing
+  * \brief Supported unit-root and stationarity tests in the panel screen
+  * \sa NDK_STATIONARITY_SCREEN()
+  */
+  typedef enum
+  {
+    STATIONARITY_ADF=1,   ///< Augmented Dickey-Fuller (null hypothesis: unit root) (see NDK_ADFTEST())
+    STATIONARITY_KPSS=2   ///< Kwiatkowski-Phillips-Schmidt-Shin (null hypothesis: stationary) (see NDK_KPSSTEST())
+  }STATIONARITY_TEST_TYPE;
+
+  /*!
+  * \ingroup statistical testing
+  * \brief Data structure to describe one test/option/lag combination of the stationarity panel screen
+  * \sa NDK_STATIONARITY_SCREEN()
+  */
+  typedef struct __STATIONARITY_TEST_SPEC__
+  {
+    WORD    test;       ///< is the test to perform (see #STATIONARITY_TEST_TYPE).
+    WORD    option;     ///< is the model description flag (see #ADFTEST_OPTION). KPSS supports ADFTEST_DRIFT_N_CONST and ADFTEST_DRIFT_N_CONST_N_TREND only.
+    WORD    K;          ///< is the lag length of the autoregressive process (ADF), or the bandwidth of the long-run variance (KPSS).
+    BOOL    testDown;   ///< is the mode of testing. If TRUE, the actual lag order used is obtained by testing down from K.
+    WORD    argMethod;  ///< is the calculation method of the KPSS test (same as the argMethod argument of NDK_KPSSTEST()). It is ignored by the ADF test.
+  }STATIONARITY_TEST_SPEC;
+
+  /*!
+  * \ingroup statistical testing
+  * \brief Supported resampling schemes of the bootstrap engine
+  * \sa NDK_MOMENTTEST_BOOTSTRAP()
+  */
+  typedef enum
+  {
+    BOOTSTRAP_IID=1,            ///< Independent (iid) resampling of single observations
+    BOOTSTRAP_MOVING_BLOCK=2,   ///< Moving (overlapping) block bootstrap with a fixed block length (Kunsch, 1989)
+    BOOTSTRAP_STATIONARY=3      ///< Stationary bootstrap with geometrically distributed block lengths (Politis and Romano, 1994)
+  }BOOTSTRAP_METHOD;
+
+  /*!
+  * \ingroup statistical testing
+  * \brief Moment statistics supported by the bootstrap engine
+  * \sa NDK_MOMENTTEST_BOOTSTRAP()
+  */
+  typedef enum
+  {
+    BOOTSTRAP_STAT_MEAN=1,      ///< Sample mean (see NDK_MEANTEST())
+    BOOTSTRAP_STAT_STDEV=2,     ///< Sample standard deviation (see NDK_STDEVTEST())
+    BOOTSTRAP_STAT_SKEW=3,      ///< Sample skew (see NDK_SKEWTEST())
+    BOOTSTRAP_STAT_XKURT=4      ///< Sample excess kurtosis (see NDK_XKURTTEST())
+  }BOOTSTRAP_STAT_TYPE;
+
+  /*!
+  * \ingroup statistical testing
+  * \brief Data structure to capture the bootstrap engine options
+  * \sa NDK_MOMENTTEST_BOOTSTRAP()
+  */
+  typedef struct __BOOTSTRAP_OPTIONS__
+  {
+    BOOTSTRAP_METHOD  method;     ///< is the resampling scheme (see #BOOTSTRAP_METHOD).
+    size_t    nReplicates;        ///< is the number of bootstrap replicates. If missing (zero), a default of 1,000 is assumed.
+    double    blockSize;          ///< is the block length (moving-block) or the mean block length (stationary). If missing (zero), \f$N^{1/3}\f$ is assumed. Ignored for iid.
+    ULONGLONG seed;               ///< is the key of the counter-based random number generator. The same seed reproduces the same replicates regardless of nThreads.
+    size_t    nThreads;           ///< is the maximum number of worker threads (0 = one per logical processor).
+  }BOOTSTRAP_OPTIONS;
+
+  /*!
+  * \brief Opaque handle of an object (e.g. transform pipeline) created by the SDK
+  * \note The object is created by an NDK_XXX_INIT function, and must be released by the matching NDK_XXX_CLEANUP function.
+  * \sa NDK_TRANSFORM_INIT(), NDK_TRANSFORM_CLEANUP(), NDK_INTERPOLATOR_INIT(), NDK_RESAMPLER_INIT()
+  */
+  typedef LPVOID NDK_HANDLE;
+
+  /*!
+  * \brief Supported operations of a transform pipeline
+  * \sa NDK_TRANSFORM_INIT()
+  */
+  typedef enum
+  {
+    TRANSFORM_RMNA=1,       ///< Remove missing values (see NDK_RMNA()). It must be the first step, and it is skipped by the inverse pipeline.
+    TRANSFORM_BOXCOX=2,     ///< Box-Cox transformation (see NDK_BOXCOX()). Inverse: inverse Box-Cox.
+    TRANSFORM_DIFF=3,       ///< Difference (see NDK_DIFF()). Inverse: integration (see NDK_INTEG()) from the recorded initial values.
+    TRANSFORM_LAG=4,        ///< Lag/backshift (see NDK_LAG()). Inverse: forward shift.
+    TRANSFORM_DETREND=5,    ///< Polynomial detrending (see NDK_DETREND()). Inverse: add back the recorded (and extrapolated) trend.
+    TRANSFORM_SCALE=6       ///< Scale by a constant (see NDK_SCALE()). Inverse: divide by the constant.
+  }TRANSFORM_STEP_TYPE;
+
+  /*!
+  * \brief Data structure to describe one step of a transform pipeline
+  * \note Only the fields used by the step type are read; the others are ignored.
+  * \sa NDK_TRANSFORM_INIT()
+  */
+  typedef struct __TRANSFORM_STEP__
+  {
+    TRANSFORM_STEP_TYPE step;   ///< is the operation to perform (see #TRANSFORM_STEP_TYPE).
+    size_t  S;                  ///< is the lag order (DIFF and LAG).
+    size_t  D;                  ///< is the number of repeated differencing (DIFF).
+    WORD    polyOrder;          ///< is the order of the polynomial time trend (DETREND): 0=mean, 1=constant and trend, 2=constant, trend and squared trend.
+    double  lambda;             ///< is the power parameter (BOXCOX). If missing (NaN), the optimal lambda is calculated from the data (see NDK_BOXCOX_PARAM()).
+    double  alpha;              ///< is the shift parameter (BOXCOX).
+    double  K;                  ///< is the scalar/multiplier value (SCALE).
+  }TRANSFORM_STEP;
 
+  /*!
+  * \brief Supported aggregation functions of the irregular-timestamp resampler
+  * \sa NDK_RESAMPLER_INIT()
+  */
+  typedef enum
+  {
+    RESAMPLE_LAST=1,    ///< Last observation in the bin (stock)
+    RESAMPLE_FIRST=2,   ///< First observation in the bin (stock)
+    RESAMPLE_SUM=3,     ///< Sum of the observations in the bin (flow)
+    RESAMPLE_MEAN=4,    ///< Average of the observations in the bin
+    RESAMPLE_OHLC=5,    ///< Open, high, low and close of the bin (four values per bin)
+    RESAMPLE_VWAP=6     ///< Volume-weighted average of the observations in the bin (requires the volumes)
+  }RESAMPLE_AGGREGATE_FUNC;
+
+  /*!
+  * \brief Data structure to capture the irregular-timestamp resampler options
+  * \note The time stamps are expressed in days (e.g. Excel serial date-time), and the bins are left-closed: \f$[t_i, t_{i+1})\f$.
+  * \sa NDK_RESAMPLER_INIT()
+  */
+  typedef struct __RESAMPLE_OPTIONS__
+  {
+    RESAMPLE_AGGREGATE_FUNC aggregate;  ///< is the aggregation function applied to the observations of each bin (see #RESAMPLE_AGGREGATE_FUNC).
+    BOOL    isStock;                    ///< is a switch to select the semantics of empty bins: TRUE = stock (level, imputed), FALSE = flow (zero sum / missing mean).
+    IMPUTATION_METHOD imputation;       ///< is the method used to fill the empty bins of a stock (see #IMPUTATION_METHOD).
+    double  startTime;                  ///< is the time stamp of the start of the first bin (regular grid).
+    double  interval;                   ///< is the width of the bins (regular grid), e.g. 1/1440 for one minute.
+    const double* pGrid;                ///< is the array of the bin start time stamps (calendar grid, sorted in ascending order). If NULL, the regular grid (startTime, interval) is used.
+    size_t  nGrid;                      ///< is the number of elements in pGrid.
+  }RESAMPLE_OPTIONS;
+
+  /*!
+  * \brief Supported exponential smoothing models of the panel optimization
+  * \sa NDK_ESMTH_PARAM_BATCH()
+  */
+  typedef enum
+  {
+    ESMTH_SIMPLE=1,     ///< (Brown's) simple exponential smoothing (see NDK_SESMTH())
+    ESMTH_DOUBLE=2,     ///< (Holt-Winter's) double exponential smoothing (see NDK_DESMTH())
+    ESMTH_LINEAR=3,     ///< (Brown's) linear exponential smoothing (see NDK_LESMTH())
+    ESMTH_TRIPLE=4      ///< (Winters's) triple exponential smoothing (see NDK_TESMTH())
+  }ESMTH_MODEL_TYPE;
+
+  /*!
+  * \brief Data structure to capture the elastic net path options
+  * \sa NDK_MLR_ENET_PATH()
+  */
+  typedef struct __ENET_OPTIONS__
+  {
+    double  l1Ratio;          ///< is the elastic net mixing parameter, between zero (ridge) and one (lasso).
+    size_t  nLambdas;         ///< is the number of penalty values on the path. If missing (zero), a default of 100 is assumed.
+    double  lambdaMinRatio;   ///< is the ratio of the smallest to the largest penalty of the path (the largest is the smallest penalty that zeroes every coefficient). If missing (zero), a default of 0.0001 is assumed.
+    BOOL    bStandardize;     ///< is a switch to standardize the explanatory variables before fitting. The coefficients are always returned on the original scale.
+    size_t  nFolds;           ///< is the number of cross-validation folds: 0 = no cross-validation, or 2 to the number of observations. One fold is an error (it leaves no training data).
+    BOOL    bContiguousFolds; ///< is a switch to use contiguous blocks of observations as folds (e.g. for time series), instead of a random assignment.
+    ULONGLONG seed;           ///< is the seed of the random assignment of the observations to the folds.
+    size_t  maxIter;          ///< is the maximum number of coordinate descent sweeps per penalty value. If missing (zero), a default of 1,000 is assumed.
+    double  tolerance;        ///< is the convergence tolerance (maximum coefficient change). If missing (zero), a default of 1e-7 is assumed.
+    size_t  nThreads;         ///< is the maximum number of worker threads (0 = one per logical processor).
+  }ENET_OPTIONS;
+
+  /*!
+  * \brief Supported decomposition backends of the principal component analysis
+  * \sa NDK_PCA_INIT()
+  */
+  typedef enum
+  {
+    PCA_SOLVER_FULL=1,        ///< Eigen-decomposition of the full covariance (correlation) matrix: \f$O(nk^2 + k^3)\f$
+    PCA_SOLVER_RANDOMIZED=2,  ///< Randomized range finder with power iterations, followed by the SVD of the projected data: \f$O(nkr)\f$
+    PCA_SOLVER_LANCZOS=3      ///< Lanczos bidiagonalization (with restarts) of the data matrix: \f$O(nkr)\f$ per restart
+  }PCA_SOLVER_TYPE;
+
+  /*!
+  * \brief Data structure to capture the principal component analysis backend options
+  * \sa NDK_PCA_INIT()
+  */
+  typedef struct __PCA_OPTIONS__
+  {
+    PCA_SOLVER_TYPE solver;   ///< is the decomposition backend (see #PCA_SOLVER_TYPE).
+    size_t    nRank;          ///< is the target rank (number of principal components to compute). If missing (zero), all the components are computed (full backend only).
+    size_t    nOversample;    ///< is the number of extra random directions of the randomized range finder. If missing (zero), a default of 10 is assumed.
+    size_t    nPowerIter;     ///< is the number of power (subspace) iterations of the randomized range finder. If missing (zero), a default of 2 is assumed.
+    ULONGLONG seed;           ///< is the seed of the random test matrix (randomized backend).
+    size_t    nThreads;       ///< is the maximum number of worker threads (0 = one per logical processor).
+  }PCA_OPTIONS;
+#endif // NDK_PREVIEW_API
 
 }
 
@@ -637,6 +941,33 @@ extern "C"
 						double* retVal ///< [out] is the calculated value of this function.
                         );   
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Returns the correlation matrix (Pearson, Spearman or Kendall) of the time series in a panel.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. The output is the symmetric M by M correlation matrix (row-major) with ones on the diagonal. The (i,j) element equals NDK_XCF() of columns i and j with no lag.
+  *   \note 3. Pearson: the columns are centered and scaled once, and the matrix is computed as a blocked (cache-tiled) symmetric rank-k product \f$Z^\top Z\f$.
+  *   \note 4. Spearman: each column is ranked once (average ranks for ties), and the Pearson correlation of the ranks is computed as above.
+  *   \note 5. Kendall: each pair is computed with Knight's \f$O(N \log N)\f$ algorithm (sort by the first series, then count the discordant pairs with a merge sort), 
+  *            and the sort order of each column is computed once and reused by every pair.
+  *   \note 6. With the pairwise policy, the pairs with missing values take the exact (slower) per-pair path; complete pairs still use the blocked product.
+  *   \note 7. The upper-triangle blocks (or pairs) are distributed across up to nThreads workers.
+  *   \sa NDK_XCF(), #CORRELATION_METHOD, #CORR_MISSING_POLICY
+  */
+  int __stdcall NDK_CORR_MATRIX(double** XX,        ///< [in] is the panel (multivariate time series) matrix data (two dimensional).
+                                size_t N,           ///< [in] is the number of observations (rows) in XX.
+                                size_t M,           ///< [in] is the number of time series (columns) in XX.
+                                WORD method,        ///< [in] is the algorithm to use for calculating the correlation (see #CORRELATION_METHOD).
+                                WORD missingPolicy, ///< [in] is the missing values handling policy (see #CORR_MISSING_POLICY).
+                                size_t nThreads,    ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                double* retVal,     ///< [out] is the calculated correlation matrix (M by M, row-major).
+                                size_t* nObs        ///< [out, optional] is the number of observations used for each coefficient (M by M, row-major). If NULL, it is not returned.
+                                );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Returns the sample root mean square (RMS).
   *   \return status code of the operation
@@ -1398,6 +1729,78 @@ extern "C"
                                                 ///       3. Critical value
                               double* retVal    ///< [out] is the calculated test statistics.
                               );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Returns the normality test statistics for every position of a window sliding by one observation over the sample.
+  *   \note 1. The output holds \f$N-W+1\f$ values; the i-th value is the test statistics of the window \f$x_{i},\dots,x_{i+W-1}\f$ (i.e. NDK_NORMALTEST() on that window).
+  *   \note 2. For the Jarque-Bera test, the first four power sums are updated incrementally as the window slides, so the cost per window is \f$O(1)\f$ instead of \f$O(W)\f$. 
+  *            The power sums are re-anchored (recomputed from scratch) every W positions to bound the accumulated rounding error.
+  *   \note 3. The other methods (Shapiro-Wilk, Doornik-Hansen) are evaluated on each window.
+  *   \note 4. A window that includes a missing value (e.g. NaN) yields a missing value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than \f$N-W+1\f$.
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_NORMALTEST(), NDK_WNTEST_ROLL(), NDK_ARCHTEST_ROLL()
+  */
+  int __stdcall NDK_NORMALTEST_ROLL(double* X,        ///< [in] is the sample data (a one dimensional array).
+                                    size_t N,         ///< [in] is the number of observations in X.
+                                    size_t W,         ///< [in] is the window length (number of observations in each window).
+                                    double alpha,     ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                    WORD method,      ///< [in] is the statistical test to perform (1=Jarque-Bera, 2=Shapiro-Wilk, 3=Chi-Square (Doornik and Hansen)).
+                                    WORD retType,     ///< [in] is a switch to select the return output (see #TEST_RETURN).
+                                    double* retVal,   ///< [out] is the calculated test statistics of each window (an array of N-W+1 elements).
+                                    size_t nOutSize   ///< [in] is the size of retVal.
+                                    );
+
+  /*!
+  *   \brief Returns the portmanteau (white-noise) test statistics for every position of a window sliding by one observation over the time series.
+  *   \note 1. The output holds \f$N-W+1\f$ values; the i-th value is the test statistics of the window \f$x_{i},\dots,x_{i+W-1}\f$ (i.e. NDK_WNTEST() on that window).
+  *   \note 2. The window sum and the K lagged cross-product sums \f$\sum x_t x_{t-k}\f$ are updated incrementally (one entering and one leaving observation per lag), 
+  *            so the autocorrelations, and the Ljung-Box statistics, cost \f$O(K)\f$ per window instead of \f$O(W \times K)\f$.
+  *   \note 3. The accumulators are re-anchored (recomputed from scratch) every W positions to bound the accumulated rounding error.
+  *   \note 4. A window that includes a missing value (e.g. NaN) yields a missing value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than \f$N-W+1\f$.
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_WNTEST(), NDK_NORMALTEST_ROLL(), NDK_ARCHTEST_ROLL()
+  */
+  int __stdcall NDK_WNTEST_ROLL(double* X,        ///< [in] is the univariate time series data (a one dimensional array).
+                                size_t N,         ///< [in] is the number of observations in X.
+                                size_t W,         ///< [in] is the window length (number of observations in each window).
+                                size_t K,         ///< [in] is the lag order (e.g. k=0 (no lag), k=1 (1st lag), etc.).
+                                double alpha,     ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                WORD method,      ///< [in] is the statistical test to perform (1=Ljung-Box).
+                                WORD retType,     ///< [in] is a switch to select the return output (see #TEST_RETURN).
+                                double* retVal,   ///< [out] is the calculated test statistics of each window (an array of N-W+1 elements).
+                                size_t nOutSize   ///< [in] is the size of retVal.
+                                );
+
+  /*!
+  *   \brief Returns the ARCH effect test statistics for every position of a window sliding by one observation over the time series.
+  *   \note 1. The output holds \f$N-W+1\f$ values; the i-th value is the test statistics of the window \f$x_{i},\dots,x_{i+W-1}\f$ (i.e. NDK_ARCHTEST() on that window).
+  *   \note 2. The test is the white-noise test of the squared (demeaned) window; the same incremental accumulators as NDK_WNTEST_ROLL() are used on the squared values, 
+  *            with the window mean correction applied in closed form, so the cost per window is \f$O(K)\f$.
+  *   \note 3. A window that includes a missing value (e.g. NaN) yields a missing value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than \f$N-W+1\f$.
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_ARCHTEST(), NDK_NORMALTEST_ROLL(), NDK_WNTEST_ROLL()
+  */
+  int __stdcall NDK_ARCHTEST_ROLL(double* X,        ///< [in] is the univariate time series data (a one dimensional array).
+                                  size_t N,         ///< [in] is the number of observations in X.
+                                  size_t W,         ///< [in] is the window length (number of observations in each window).
+                                  size_t K,         ///< [in] is the lag order (e.g. k=0 (no lag), k=1 (1st lag), etc.).
+                                  double alpha,     ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                  WORD method,      ///< [in] is the statistical test to perform (1=Ljung-Box).
+                                  WORD retType,     ///< [in] is a switch to select the return output (see #TEST_RETURN).
+                                  double* retVal,   ///< [out] is the calculated test statistics of each window (an array of N-W+1 elements).
+                                  size_t nOutSize   ///< [in] is the size of retVal.
+                                  );
+#endif // NDK_PREVIEW_API
   /*! 
   *   \brief Calculates the p-value of the statistical test for the population mean.
   *   \return status code of the operation
@@ -1470,6 +1873,35 @@ extern "C"
                                                 ///       3. Critical value
                               double* retVal    ///< [out] is the calculated test statistics.
                               );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Calculates the bootstrap p-values and confidence intervals of one or more moment statistics (mean, standard deviation, skew and excess kurtosis) in one call.
+  *   \note 1. The bootstrap tests do not rely on the asymptotic normality of the sample statistics, so they remain valid for heavy-tailed data (e.g. asset returns).
+  *   \note 2. Each replicate is drawn once, and all the requested statistics are computed from its first four power sums in a single pass, 
+  *            so the resampled data never needs to be materialized and the working set stays in cache.
+  *   \note 3. The replicates are generated by a counter-based random number generator (keyed by the seed, indexed by the replicate number), 
+  *            so they are split across nThreads workers without any shared state, and the results are reproducible for any number of threads.
+  *   \note 4. The p-value is two-sided and computed from the replicates recentred at the sample statistics: \f$p = \frac{1+\#\{|\theta^*_b-\hat\theta| \geq |\hat\theta-\theta_0|\}}{1+B}\f$.
+  *   \note 5. The confidence interval is the percentile interval at the \f$1-\alpha\f$ confidence level.
+  *   \note 6. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_MEANTEST(), NDK_STDEVTEST(), NDK_SKEWTEST(), NDK_XKURTTEST()
+  */
+  int __stdcall NDK_MOMENTTEST_BOOTSTRAP( double* X,                          ///< [in] is the sample data (a one dimensional array).
+                                          size_t N,                           ///< [in] is the number of observations in X.
+                                          const WORD* stats,                  ///< [in] is an array of the moment statistics to test (see #BOOTSTRAP_STAT_TYPE).
+                                          const double* targets,              ///< [in, optional] is an array of the assumed (null hypothesis) values of the statistics. If NULL, zero is assumed (one for the standard deviation).
+                                          size_t nStats,                      ///< [in] is the number of elements in stats (and targets).
+                                          const BOOTSTRAP_OPTIONS* pOptions,  ///< [in] is the resampling options (see #BOOTSTRAP_OPTIONS).
+                                          double alpha,                       ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                          double* retPValue,                  ///< [out, optional] is the bootstrap p-value of each statistics (an array of nStats elements).
+                                          double* retLower,                   ///< [out, optional] is the lower limit of the confidence interval of each statistics (an array of nStats elements).
+                                          double* retUpper                    ///< [out, optional] is the upper limit of the confidence interval of each statistics (an array of nStats elements).
+                                          );
+#endif // NDK_PREVIEW_API
   /*! 
   *   \brief Calculates the test stats, p-value or critical value of the correlation test.
   *   \return status code of the operation
@@ -1515,6 +1947,84 @@ extern "C"
                             );
   int __stdcall NDK_KPSSTEST(double* pData, size_t nSize, WORD maxOrder, WORD option, BOOL testDown, WORD argMethod, WORD retType, double alpha, double* retVal);
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Returns the p-value and the critical value of the Augmented Dickey-Fuller (ADF) test statistics for a given sample size.
+  *   \note 1. The distribution is evaluated from precomputed (MacKinnon-style) response-surface coefficients for every #ADFTEST_OPTION model: 
+  *            \f$\tau_{\alpha}(T) = \beta_{\infty} + \beta_1/T + \beta_2/T^2 + \beta_3/T^3\f$, so each evaluation takes constant time.
+  *   \note 2. The p-value is not interpolated between the tabulated significance levels: it is MacKinnon's (1994) approximate distribution function 
+  *            \f$p=\Phi(\gamma_0+\gamma_1\tau+\gamma_2\tau^2+\gamma_3\tau^3)\f$, with one set of \f$\gamma\f$ coefficients per model for each tail, i.e. the method of NDK_ADFTEST(). 
+  *            The p-value and the critical value match NDK_ADFTEST() (retType = TEST_PVALUE and TEST_CRITICALVALUE) up to rounding.
+  *   \note 3. The coefficient tables are static data of the library; they are checked once by NDK_Init(), and the function fails if it is called before NDK_Init().
+  *   \note 4. NDK_STATIONARITY_SCREEN() evaluates its ADF p-values and critical values with this function.
+  *   \note 5. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_ADFTEST(), NDK_KPSSTEST_DIST(), NDK_JOHANSENTEST_DIST()
+  */
+  int __stdcall NDK_ADFTEST_DIST( double score,             ///< [in] is the ADF test statistics (t-stat of the lagged level coefficient).
+                                  size_t N,                 ///< [in] is the number of observations used in the test regression.
+                                  ADFTEST_OPTION options,   ///< [in] is the model description flag for the Dickey-Fuller test variant (see #ADFTEST_OPTION).
+                                  double alpha,             ///< [in] is the statistical significance level of the critical value. If missing, a default of 5% is assumed.
+                                  double* retPValue,        ///< [out, optional] is the p-value of the test statistics.
+                                  double* retCV             ///< [out, optional] is the critical value at the alpha significance level.
+                                  );
+
+  /*!
+  *   \brief Returns the p-value and the critical value of the KPSS test statistics.
+  *   \note 1. The critical values at the 10%, 5%, 2.5% and 1% significance levels are evaluated from precomputed response-surface coefficients (level and trend stationarity).
+  *   \note 2. The p-value is interpolated linearly between those critical values, and clipped to the range of the table (1% to 10%), i.e. the method of NDK_KPSSTEST(). 
+  *            The p-value and the critical value match NDK_KPSSTEST() (retType = TEST_PVALUE and TEST_CRITICALVALUE) up to rounding.
+  *   \note 3. The coefficient tables are static data of the library; they are checked once by NDK_Init(), and the function fails if it is called before NDK_Init().
+  *   \note 4. NDK_STATIONARITY_SCREEN() evaluates its KPSS p-values and critical values with this function.
+  *   \note 5. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_KPSSTEST(), NDK_ADFTEST_DIST(), NDK_JOHANSENTEST_DIST()
+  */
+  int __stdcall NDK_KPSSTEST_DIST(double score,             ///< [in] is the KPSS test statistics.
+                                  size_t N,                 ///< [in] is the number of observations used in the test.
+                                  WORD option,              ///< [in] is the model description flag for the KPSS test variant (same as NDK_KPSSTEST()).
+                                  double alpha,             ///< [in] is the statistical significance level of the critical value. If missing, a default of 5% is assumed.
+                                  double* retPValue,        ///< [out, optional] is the p-value of the test statistics.
+                                  double* retCV             ///< [out, optional] is the critical value at the alpha significance level.
+                                  );
+
+  /*!
+  *   \brief Evaluates a set of unit-root/stationarity tests (ADF and KPSS, with several options and lag orders) on every time series of a panel.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. Each time series may include missing values (e.g. NaN) at either end.
+  *   \note 3. For every series and model option, the lagged regression design is built once (for the largest lag order requested) and factorized once (QR).
+  *            The regressions of the smaller lag orders are leading column subsets of that design, so they are solved from the same factorization.
+  *            To keep the regressions nested, all lag orders of a series/option are estimated on the common sample (i.e. the first \f$K_{max}+1\f$ observations are dropped).
+  *            As a result, for a lag order \f$K<K_{max}\f$, the test statistics differ from NDK_ADFTEST(), which only drops the first \f$K+1\f$ observations. 
+  *            To reproduce NDK_ADFTEST() exactly, screen each lag order in a separate call.
+  *   \note 4. The KPSS tests of a series/option share the detrending regression; the lag order only affects the long-run variance estimate.
+  *   \note 5. The series are processed independently and in parallel (up to nThreads workers).
+  *   \note 6. Each output table holds M rows (one per series) by nSpecs columns (one per test specification), row-major. A missing output buffer (NULL) is skipped.
+  *   \note 7. A failed test (e.g. too few non-missing observations for the lag order) sets its cell in every output table to NaN, and the screen moves on to the next specification.
+  *            pStatus holds, for each series, the error code of its first failed specification (or #NDK_SUCCESS).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful for one or more series (see pStatus). see \ref SFMacros.h
+  *   \sa NDK_ADFTEST(), NDK_KPSSTEST()
+  */
+  int __stdcall NDK_STATIONARITY_SCREEN(double** XX,                        ///< [in] is the panel (multivariate time series) matrix data (two dimensional).
+                                        size_t N,                           ///< [in] is the number of observations (rows) in XX.
+                                        size_t M,                           ///< [in] is the number of time series (columns) in XX.
+                                        const STATIONARITY_TEST_SPEC* specs,///< [in] is the array of test specifications (see #STATIONARITY_TEST_SPEC).
+                                        size_t nSpecs,                      ///< [in] is the number of elements in specs.
+                                        double alpha,                       ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                        size_t nThreads,                    ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                        double* retPValue,                  ///< [out, optional] is the table of the p-values (M by nSpecs).
+                                        double* retScore,                   ///< [out, optional] is the table of the test statistics (M by nSpecs).
+                                        double* retCV,                      ///< [out, optional] is the table of the critical values (M by nSpecs).
+                                        int* pStatus                        ///< [out, optional] is the status code of each series (an array of M elements). If NULL, it is not returned.
+                                        );
+#endif // NDK_PREVIEW_API
+
 
   /*! 
   *   \brief Returns the Johansen (cointegration) test statistics for two or more time series.
@@ -1546,6 +2056,61 @@ extern "C"
                                  double *retCV        ///< [out] is the calculated test critical value.
                                  );                   /// \example sdk_cointegration.cpp
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Returns the p-value and the critical value of the Johansen (trace or maximal eigenvalue) test statistics.
+  *   \note 1. The asymptotic distribution is evaluated from precomputed response-surface coefficients for every deterministic term (nPolyOrder) and 
+  *            every number of common stochastic trends \f$M-r\f$ (1 to 12).
+  *   \note 2. NDK_JOHANSENTEST_BATCH() evaluates its critical values with this function.
+  *   \note 3. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful. see \ref SFMacros.h
+  *   \sa NDK_JOHANSENTEST(), NDK_ADFTEST_DIST(), NDK_KPSSTEST_DIST()
+  */
+  int __stdcall NDK_JOHANSENTEST_DIST(double score,         ///< [in] is the Johansen test statistics.
+                                      size_t M,             ///< [in] is the number of variables.
+                                      WORD R,               ///< [in] is the assumed number of cointegrating relationships (r) under the null hypothesis.
+                                      short nPolyOrder,     ///< [in] is the order of the polynomial: (-1=no constant, 0=contant-only (default), 1=constant and trend).
+                                      BOOL tracetest,       ///< [in] is a flag to select test: TRUE=trace, FALSE=maximal eignvalue test.
+                                      double alpha,         ///< [in] is the statistical significance level of the critical value. If missing, a default of 5% is assumed.
+                                      double* retPValue,    ///< [out, optional] is the p-value of the test statistics.
+                                      double* retCV         ///< [out, optional] is the critical value at the alpha significance level.
+                                      );
+
+  /*!
+  *   \brief Returns the Johansen (cointegration) trace and maximal eigenvalue test statistics for many baskets (e.g. pairs) of time series drawn from one panel.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. Each basket (or tuple) is a set of nTupleSize distinct (zero-based) column indexes into the panel; the tuples are stored row-major in the tuples array.
+  *   \note 3. The differenced series and the lagged difference terms are computed once per panel column, and shared by every tuple that includes the column.
+  *   \note 4. The tuples are tested independently and in parallel (up to nThreads workers).
+  *   \note 5. For each tuple, the statistics and critical values are returned for every hypothesis \f$r=0,1,\dots,nTupleSize-1\f$, so each output array holds nTuples rows by nTupleSize columns (row-major).
+  *   \note 6. The statistics are identical to those returned by NDK_JOHANSENTEST() for the same basket.
+  *   \note 7. A basket with a repeated or out-of-range column index, or with a singular residual moment matrix, does not stop the others: 
+  *            its rows in the four output arrays are set to NaN, and its error code is stored in pStatus.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful for one or more tuples (see pStatus). see \ref SFMacros.h
+  *   \sa NDK_JOHANSENTEST(), NDK_ADFTEST()
+  */
+  int __stdcall NDK_JOHANSENTEST_BATCH( double** XX,          ///< [in] is the panel (multivariate time series) matrix data (two dimensional).
+                                        size_t N,             ///< [in] is the number of observations (rows) in XX.
+                                        size_t M,             ///< [in] is the number of variables (columns) in XX.
+                                        const size_t* tuples, ///< [in] is the array of the (zero-based) column indexes of each basket (nTuples rows by nTupleSize columns, row-major).
+                                        size_t nTuples,       ///< [in] is the number of baskets (tuples) to test.
+                                        size_t nTupleSize,    ///< [in] is the number of variables in each basket (2 = pairs, no more than 12).
+                                        size_t K,             ///< [in] is the number of lagged difference terms used when computing the estimator.
+                                        short nPolyOrder,     ///< [in] is the order of the polynomial: (-1=no constant, 0=contant-only (default), 1=constant and trend).
+                                        double alpha,         ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                        size_t nThreads,      ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                        double* retTraceStat, ///< [out] is the calculated trace test statistics (nTuples by nTupleSize).
+                                        double* retTraceCV,   ///< [out] is the calculated trace test critical values (nTuples by nTupleSize).
+                                        double* retEigenStat, ///< [out] is the calculated maximal eigenvalue test statistics (nTuples by nTupleSize).
+                                        double* retEigenCV,   ///< [out] is the calculated maximal eigenvalue test critical values (nTuples by nTupleSize).
+                                        int* pStatus          ///< [out, optional] is the status code of each tuple (an array of nTuples elements). If NULL, it is not returned.
+                                        );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Returns the collinearity test statistics for a set of input variables.
   *   \note 1. Each column in the input matrix corresponds to a separate time series variable.
@@ -1735,7 +2300,7 @@ extern "C"
                              );
 
   /*! 
-  *   \brief Computes the complementary log-log transformation, including its inverse.
+  *   \brief Computes the logit transformation, including its inverse.
   *   \return status code of the operation
   *   \retval #NDK_SUCCESS Operation successful
   *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
@@ -1746,6 +2311,25 @@ extern "C"
                             WORD retTYpe      ///< [in] is a number that determines the type of return value: 1 (or missing)=logit, 2=inverse logit.
                             );
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Computes the link function of a generalized linear model (GLM), including its inverse (i.e. the mean function).
+  *   \note 1. The logit, probit and complementary log-log links (and their inverses) are evaluated by vectorized kernels (AVX-512, AVX2 or scalar fallback, selected at run time).
+  *   \note 2. The probit link (inverse normal CDF) uses Wichura's rational approximation (AS241), and its inverse (normal CDF) uses a rational approximation of erfc.
+  *   \note 3. The link values match NDK_LOGIT(), NDK_PROBIT() and NDK_CLOGLOG() up to rounding.
+  *   \note 4. The inverse link is applied to the linear predictor (e.g. when scoring a GLM model on new data).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_LOGIT(), NDK_PROBIT(), NDK_CLOGLOG(), NDK_GLM_FITTED()
+  */
+  int   __stdcall NDK_GLM_LINK( double *X,        ///< [inout] is the mean (retType=1) or the linear predictor (retType=2) values (a one dimensional array), overwritten by the transformed values.
+                                size_t N,         ///< [in] is the number of observations in X. 
+                                WORD Lvk,         ///< [in] is the link function (see #GLM_LINK_FUNC).
+                                WORD retType      ///< [in] is a number that determines the type of return value: 1 (or missing)=link, 2=inverse link.
+                                );
+#endif // NDK_PREVIEW_API
+
 
   /*! 
   *   \brief Computes the complementary log-log transformation, including its inverse.
@@ -1763,6 +2347,49 @@ extern "C"
                               double *retVal  ///< [out] is the calculated log-likelihood value of the transform (retType=3).
                               );
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Returns the optimal (maximum log-likelihood) power parameter (lambda) of the Box-Cox transformation.
+  *   \note 1. The logarithms \f$\ln(x_t+\alpha)\f$ and their sum (the Jacobian term) are computed once; each evaluation of the profile log-likelihood 
+  *            \f$-\frac{N}{2}\ln\hat\sigma^2(\lambda) + (\lambda-1)\sum \ln(x_t+\alpha)\f$ then only needs the vectorized \f$e^{\lambda \ln(x_t+\alpha)}\f$ on the cached logarithms, 
+  *            and the data is never re-transformed in place.
+  *   \note 2. The search is a bracketed (Brent) one-dimensional maximization over \f$[-2, 2]\f$ of the profile log-likelihood (same value as NDK_BOXCOX() with retType=3).
+  *   \note 3. The time series may include missing values (e.g. NaN); they are excluded from the calculation.
+  *   \note 4. The input data is not modified; call NDK_BOXCOX() with the returned lambda to transform it.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_BOXCOX(), NDK_BOXCOX_PARAM_BATCH()
+  */
+  int   __stdcall NDK_BOXCOX_PARAM( const double *X,  ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t N,         ///< [in] is the number of observations in X. 
+                                    double alpha,     ///< [in] is the input shift parameter for X. If omitted, the default value is 0. 
+                                    double* lambda,   ///< [out] is the calculated optimal power parameter of the transformation.
+                                    double* retVal    ///< [out, optional] is the log-likelihood value of the transform at the optimal lambda.
+                                    );
+
+  /*! 
+  *   \brief Returns the optimal power parameter (lambda) of the Box-Cox transformation for many time series in one call.
+  *   \note 1. The time series may have different lengths.
+  *   \note 2. Each time series is optimized as in NDK_BOXCOX_PARAM(), independently and in parallel (up to nThreads workers).
+  *   \note 3. A time series with a non-positive shifted value (\f$x_t+\alpha \le 0\f$), or fewer than two non-missing values, gets a NaN lambda (and log-likelihood) 
+  *            and its error code in pStatus; the other time series are still optimized.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful for one or more time series (see pStatus). See \ref SFMacros.h for more details.
+  *   \sa NDK_BOXCOX(), NDK_BOXCOX_PARAM()
+  */
+  int   __stdcall NDK_BOXCOX_PARAM_BATCH( double** pData,         ///< [in] is the array of univariate time series data (one column per time series).
+                                          const size_t* nSizes,   ///< [in] is the number of observations in each time series (an array of nSeries elements).
+                                          size_t nSeries,         ///< [in] is the number of time series.
+                                          const double* alphas,   ///< [in, optional] is the shift parameter of each time series (an array of nSeries elements). If NULL, zero is assumed.
+                                          size_t nThreads,        ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                          double* lambdas,        ///< [out] is the calculated optimal power parameter of each time series (an array of nSeries elements).
+                                          double* retVals,        ///< [out, optional] is the log-likelihood value of each transform at its optimal lambda (an array of nSeries elements).
+                                          int* pStatus            ///< [out, optional] is the status code of each time series (an array of nSeries elements). If NULL, it is not returned.
+                                          );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Detrends a time series using a regression of y against a polynomial time trend of order p.
   *   \return status code of the operation
@@ -1790,6 +2417,71 @@ extern "C"
                                   size_t period ///< [in] is the number of observations(i.e. points) in one season.
                                   );
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Creates a transform pipeline: a sequence of transforms (e.g. Box-Cox, difference, detrend, scale) applied together to a time series.
+  *   \note 1. The pipeline is released by NDK_TRANSFORM_CLEANUP().
+  *   \note 2. The steps are executed in the order given by NDK_TRANSFORM_APPLY(), and in the reverse order (using the inverse operators) by NDK_TRANSFORM_INVERSE().
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_TRANSFORM_APPLY(), NDK_TRANSFORM_INVERSE(), NDK_TRANSFORM_CLEANUP()
+  */
+  int   __stdcall NDK_TRANSFORM_INIT( const TRANSFORM_STEP* steps,  ///< [in] is the array of the pipeline steps (see #TRANSFORM_STEP).
+                                      size_t nSteps,                ///< [in] is the number of elements in steps.
+                                      NDK_HANDLE* pHandle           ///< [out] is the handle of the created pipeline.
+                                      );
+
+  /*! 
+  *   \brief Applies a transform pipeline to a time series.
+  *   \note 1. Each run of consecutive stateless steps (DIFF, LAG, SCALE, or BOXCOX with a given lambda) is fused into one pass over the data: 
+  *            the data is read in cache-sized tiles, and every step of the run is applied to a tile before moving to the next one. 
+  *            A step that needs a statistic of the whole series (the trend coefficients of DETREND, or the fitted lambda of BOXCOX) 
+  *            needs the full output of the upstream steps, so it adds a pass: a pipeline with k such steps reads the data k+1 times 
+  *            (e.g. BOXCOX with a fitted lambda, then DIFF, then DETREND takes three passes).
+  *   \note 2. The input data is not modified, so no copy of the original is needed. X and Y must not overlap.
+  *   \note 3. The values needed by the inverse pipeline (e.g. the initial values of DIFF, the trend coefficients of DETREND and the lambda of BOXCOX) are recorded in the pipeline.
+  *   \note 4. The output has the same length as the input (the leading observations lost by DIFF and LAG are set to missing), unless the pipeline starts with RMNA.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_TRANSFORM_INIT(), NDK_TRANSFORM_INVERSE(), NDK_TRANSFORM_CLEANUP()
+  */
+  int   __stdcall NDK_TRANSFORM_APPLY(NDK_HANDLE hPipeline,   ///< [in] is the handle of the pipeline (see NDK_TRANSFORM_INIT()).
+                                      const double* X,        ///< [in] is the univariate time series data (a one dimensional array).
+                                      size_t N,               ///< [in] is the number of observations in X.
+                                      double* Y,              ///< [out] is the transformed time series (an array of N elements). It must not overlap X.
+                                      size_t* nOut            ///< [out] is the number of observations in Y.
+                                      );
+
+  /*! 
+  *   \brief Maps a time series (e.g. forecasts) in the transformed scale back to the original scale, by applying the inverse pipeline (e.g. INTEG, inverse Box-Cox, add trend).
+  *   \note 1. NDK_TRANSFORM_APPLY() must be called first; the inverse uses the values recorded by the last call.
+  *   \note 2. If bForecast is TRUE, the values are taken as the continuation of the last transformed series (i.e. out-of-sample forecasts): 
+  *            the integration starts from its last observations, and the trend is extrapolated. Otherwise, they are aligned with the transformed series (e.g. fitted values).
+  *   \note 3. The inverse steps are fused in the same way as in NDK_TRANSFORM_APPLY(): one pass per run of stateless steps.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_TRANSFORM_INIT(), NDK_TRANSFORM_APPLY(), NDK_TRANSFORM_CLEANUP()
+  */
+  int   __stdcall NDK_TRANSFORM_INVERSE(NDK_HANDLE hPipeline,   ///< [in] is the handle of the pipeline (see NDK_TRANSFORM_INIT()).
+                                        double* X,              ///< [inout] is the univariate time series data in the transformed scale (a one dimensional array).
+                                        size_t N,               ///< [in] is the number of observations in X.
+                                        BOOL bForecast          ///< [in] is a switch to select whether X holds out-of-sample values (TRUE) or in-sample values (FALSE).
+                                        );
+
+  /*! 
+  *   \brief Releases a transform pipeline, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
+  *   \sa NDK_TRANSFORM_INIT()
+  */
+  int   __stdcall NDK_TRANSFORM_CLEANUP(NDK_HANDLE hPipeline    ///< [in] is the handle of the pipeline (see NDK_TRANSFORM_INIT()).
+                                        );
+#endif // NDK_PREVIEW_API
+
 
 
   /*! 
@@ -1797,7 +2489,7 @@ extern "C"
   *   \return status code of the operation
   *   \retval #NDK_SUCCESS Operation successful
   *   \retval #NDK_FAILED Operation unsuccessful. See \ref SFMacros.h for more details.
-  *   \sa NDK_RMNA(), NDK_INTERPOLATE()
+  *   \sa NDK_RMNA(), NDK_INTERPOLATE(), NDK_INTERP_NAN_PANEL()
   */
   int   __stdcall	NDK_INTERP_NAN( double* X,      ///< [inout] is the univariate time series data (a one dimensional array).
                                   size_t N,       ///< [in] is the number of observations in X. 
@@ -1815,6 +2507,34 @@ extern "C"
                                   double plug     ///< [in]  is the data argument related to the selected treatment method (if applicable). For instance, if the method is constant, then the value would be the actual value.
                                   );
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Substitutes the missing values in every time series of a panel, and (optionally) returns the positions of the imputed values.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. Each column is imputed as in NDK_INTERP_NAN(), independently and in parallel (up to nThreads workers), except for the cubic spline (see note 3).
+  *   \note 3. With the cubic spline method (nMethod=7), the interior gaps of a column are filled from one natural cubic spline through all of its observed points. 
+  *            The spline's second derivatives are found with a single \f$O(N)\f$ tridiagonal (Thomas) solve over the whole column, instead of one solve per gap, 
+  *            so the imputed values may differ from the per-gap fits of NDK_INTERP_NAN(). 
+  *            The edge gaps (before the first or after the last observed value) are outside the spline's range, and fall back to the per-gap treatment of NDK_INTERP_NAN().
+  *   \note 4. The mask is filled in the same pass as the imputation, so no separate NDK_HASNA() pass is needed.
+  *   \note 5. The mask has the same layout as XX (one array per column), so every worker only writes to the arrays of its own columns.
+  *   \note 6. A column that cannot be imputed (e.g. all its values are missing) is left unchanged, with an all-zero mask, and its error code is stored in pStatus.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED Operation is unsuccessful for one or more time series (see pStatus). See \ref SFMacros.h for more details.
+  *   \sa NDK_INTERP_NAN(), NDK_HASNA()
+  */
+  int   __stdcall NDK_INTERP_NAN_PANEL( double** XX,    ///< [inout] is the panel (multivariate time series) matrix data (two dimensional).
+                                        size_t N,       ///< [in] is the number of observations (rows) in XX.
+                                        size_t M,       ///< [in] is the number of time series (columns) in XX.
+                                        WORD  nMethod,  ///< [in] is an identifier for the method used to generate values for any missing data (see NDK_INTERP_NAN()).
+                                        double plug,    ///< [in] is the data argument related to the selected treatment method (if applicable).
+                                        size_t nThreads,///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                        BYTE** pMask,   ///< [out, optional] is the mask of the imputed values (M arrays of N elements, same layout as XX): 1 = imputed, 0 = original. If NULL, it is not returned.
+                                        int* pStatus    ///< [out, optional] is the status code of each time series (an array of M elements). If NULL, it is not returned.
+                                        );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Examine whether the given array has one or more missing values.
   *   \return status code of the operation
@@ -1844,6 +2564,76 @@ extern "C"
   */
   int   __stdcall NDK_RESAMPLE(double* pData, size_t nSize, BOOL isStock, double relSampling, IMPUTATION_METHOD method, double* pOutData, size_t *newSize);
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Creates a resampler for time series with irregular time stamps (e.g. tick data), which aggregates the observations on a target grid or calendar.
+  *   \note 1. The resampler is released by NDK_RESAMPLER_CLEANUP().
+  *   \note 2. The grid is copied, so the pGrid array may be released after the call.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_RESAMPLE(), NDK_RESAMPLER_PUSH(), NDK_RESAMPLER_FLUSH(), NDK_RESAMPLER_CLEANUP()
+  */
+  int   __stdcall NDK_RESAMPLER_INIT( const RESAMPLE_OPTIONS* pOptions, ///< [in] is the aggregation, imputation and grid options (see #RESAMPLE_OPTIONS).
+                                      NDK_HANDLE* pHandle               ///< [out] is the handle of the created resampler.
+                                      );
+
+  /*!
+  *   \brief Feeds a chunk of (time stamp, value) observations to a resampler, and returns the bins completed so far.
+  *   \note 1. The observations are processed in a single streaming pass: the time stamps must be in ascending order, within and across the chunks, 
+  *            so data larger than memory can be resampled chunk by chunk.
+  *   \note 2. A bin is returned as soon as it is complete, i.e. once the observations needed to aggregate (and impute) it are received. 
+  *            The flat and linear imputations need at most the next observation; the cubic spline uses a local spline over a bounded number of later observations. 
+  *            The FFT imputation needs the whole series, and is not supported (#NDK_NOTSUPPORTED).
+  *   \note 3. nOutSize counts bins, not doubles. For OHLC, each bin returns four values (open, high, low, close), so pOutData must hold 4*nOutSize doubles (row-major, one row per bin); 
+  *            for the other aggregation functions, pOutData holds nOutSize doubles.
+  *   \note 4. The chunk is always consumed in full. The completed bins that do not fit in the output buffers are kept in the resampler, and are returned (first) by the next call.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_RESAMPLER_INIT(), NDK_RESAMPLER_FLUSH()
+  */
+  int   __stdcall NDK_RESAMPLER_PUSH( NDK_HANDLE hResampler,  ///< [in] is the handle of the resampler (see NDK_RESAMPLER_INIT()).
+                                      const double* pTimes,   ///< [in] is the time stamps of the observations (a one dimensional array, sorted in ascending order).
+                                      const double* pValues,  ///< [in] is the observed values (a one dimensional array).
+                                      const double* pVolumes, ///< [in, optional] is the traded volumes of the observations (a one dimensional array). It is required for VWAP only.
+                                      size_t nSize,           ///< [in] is the number of observations in the chunk.
+                                      double* pBinTimes,      ///< [out, optional] is the start time stamp of each completed bin.
+                                      double* pOutData,       ///< [out] is the aggregated value(s) of each completed bin (nOutSize doubles, or 4*nOutSize for OHLC).
+                                      size_t nOutSize,        ///< [in] is the maximum number of bins (not doubles) that pOutData (and pBinTimes) can hold.
+                                      size_t* nBins           ///< [out] is the number of bins returned.
+                                      );
+
+  /*!
+  *   \brief Returns the remaining (incomplete) bins of a resampler, after the last chunk has been fed.
+  *   \note 1. The last bins are aggregated and imputed with the observations received so far; the bins after the last observation are not extrapolated.
+  *   \note 2. nOutSize counts bins, not doubles (see NDK_RESAMPLER_PUSH()); for OHLC, pOutData must hold 4*nOutSize doubles.
+  *   \note 3. If the remaining bins do not fit in the output buffers, the first nOutSize bins are returned (partial output, nBins = nOutSize), the others are kept 
+  *            in the resampler, and the function returns #NDK_LENGTH_ERROR. Call NDK_RESAMPLER_FLUSH() again until it returns #NDK_SUCCESS.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful; all the remaining bins are returned.
+  *   \retval #NDK_LENGTH_ERROR The output buffers are too small; a partial output is returned, and the other bins are kept in the resampler.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_RESAMPLER_INIT(), NDK_RESAMPLER_PUSH()
+  */
+  int   __stdcall NDK_RESAMPLER_FLUSH(NDK_HANDLE hResampler,  ///< [in] is the handle of the resampler (see NDK_RESAMPLER_INIT()).
+                                      double* pBinTimes,      ///< [out, optional] is the start time stamp of each bin.
+                                      double* pOutData,       ///< [out] is the aggregated value(s) of each bin (nOutSize doubles, or 4*nOutSize for OHLC).
+                                      size_t nOutSize,        ///< [in] is the maximum number of bins (not doubles) that pOutData (and pBinTimes) can hold.
+                                      size_t* nBins           ///< [out] is the number of bins returned.
+                                      );
+
+  /*!
+  *   \brief Releases a resampler, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_RESAMPLER_INIT()
+  */
+  int   __stdcall NDK_RESAMPLER_CLEANUP(NDK_HANDLE hResampler ///< [in] is the handle of the resampler (see NDK_RESAMPLER_INIT()).
+                                        );
+#endif // NDK_PREVIEW_API
+
   int   __stdcall	NDK_INTERP_BROWN(double* pData , size_t nSize);
   ///@}
 
@@ -1977,6 +2767,298 @@ extern "C"
     double* retVal            ///< [out] is the calculated value of this function.
   );
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Creates a stateful exponential smoothing (Holt-Winters) model from its smoothing factors and its current state (level, trend and seasonal indices).
+  *   \note 1. The model is released by NDK_ESMTH_CLEANUP().
+  *   \note 2. The smoothing factors are typically the optimal values returned by NDK_GESMTH() (bOptimize=TRUE), and the state is the last values of its internals 
+  *            (wInternalSeries = 1 (level), 2 (trend) and 3 (seasonality)). NDK_TESMTH() only returns the level and the trend (wInternalSeries = 1 and 2), 
+  *            so its seasonal indices must be computed by the caller (or taken from NDK_GESMTH() with the same factors).
+  *   \note 3. The model covers every NDK_GESMTH() option: the autocorrelation adjustment (lambda and lastError) and the log transform. 
+  *            With bLogTransform, the level, the trend and the seasonal indices are in the log scale, the new observations are given in the original scale, 
+  *            and the forecasts are returned in the original scale.
+  *   \note 4. The seasonal indices are ordered from the oldest to the most recent; the first index applies to the next observation.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GESMTH(), NDK_TESMTH(), NDK_ESMTH_UPDATE(), NDK_ESMTH_FORE(), NDK_ESMTH_SAVE(), NDK_ESMTH_LOAD(), NDK_ESMTH_CLEANUP()
+  */
+  int   __stdcall NDK_ESMTH_INIT( double alpha,             ///< [in] is the data smoothing factor (alpha should be between zero and one (exclusive)).
+                                  double beta,              ///< [in] is the trend smoothing factor (beta should be between zero and one (exclusive)).
+                                  double gamma,             ///< [in] is the seasonal change smoothing factor (Gamma should be between zero and one (exclusive)).
+                                  double phi,               ///< [in] is the damping coefficient for the trend.
+                                  double lambda,            ///< [in] is the coefficient value for the autocorrelation adjustment. It is ignored if bAutoCorrelationAdj is FALSE.
+                                  WORD  TrendType,          ///< [in] is the type of trend in the model (0=none, 1=additive, 2- damped additive, 3=multiplicative, 4=damped multiplicative)
+                                  WORD  SeasonalityType,    ///< [in] is the type of seasonality in the modem (0=none, 1=additive, 2=multiplicative)
+                                  int seasonLength,         ///< [in] is the season length.
+                                  BOOL bAutoCorrelationAdj, ///< [in] is a flag (True/False) for adding a correction term for the 1st order autocorrelation (same as NDK_GESMTH()).
+                                  BOOL bLogTransform,       ///< [in] is a flag (True/False) for applying natural log transform to the data prior to smoothing (same as NDK_GESMTH()).
+                                  double level,             ///< [in] is the current level.
+                                  double trend,             ///< [in] is the current trend.
+                                  const double* seasonals,  ///< [in, optional] is the array of the last seasonLength seasonal indices. It is ignored if SeasonalityType = 0.
+                                  double lastError,         ///< [in] is the last one-step forecast error. It is ignored if bAutoCorrelationAdj is FALSE.
+                                  NDK_HANDLE* pHandle       ///< [out] is the handle of the created model.
+                                  );
+
+  /*!
+  *   \brief Updates the state of an exponential smoothing model with one or more new observations.
+  *   \note 1. Each observation updates the level, the trend and the current seasonal index in constant time (\f$O(1)\f$), independent of the length of the history.
+  *   \note 2. A missing value (e.g. NaN) advances the state with the one-step forecast in place of the observation.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ESMTH_INIT(), NDK_ESMTH_FORE()
+  */
+  int   __stdcall NDK_ESMTH_UPDATE( NDK_HANDLE hModel,  ///< [in] is the handle of the model (see NDK_ESMTH_INIT()).
+                                    const double *pData,///< [in] is the new observations, in ascending time order (a one dimensional array).
+                                    size_t nSize,       ///< [in] is the number of elements in pData.
+                                    double* retErrors   ///< [out, optional] is the one-step forecast error of each observation (an array of nSize elements). If NULL, it is not returned.
+                                    );
+
+  /*!
+  *   \brief Returns the forecasts of an exponential smoothing model for all the horizons 1 to nHorizon at once.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ESMTH_INIT(), NDK_ESMTH_UPDATE()
+  */
+  int   __stdcall NDK_ESMTH_FORE( NDK_HANDLE hModel,  ///< [in] is the handle of the model (see NDK_ESMTH_INIT()).
+                                  size_t nHorizon,    ///< [in] is the number of steps to forecast.
+                                  double* retVals     ///< [out] is the forecasts for the horizons 1 to nHorizon (an array of nHorizon elements).
+                                  );
+
+  /*!
+  *   \brief Serializes an exponential smoothing model (factors, model type and state) into a compact binary blob.
+  *   \note 1. The blob has a fixed layout (a version tag, the model type and flags, the smoothing factors and lambda, the level, the trend, the last one-step error 
+  *            and the seasonal indices, as little-endian doubles), 
+  *            so its size only depends on the season length.
+  *   \note 2. If pBlob is NULL, the required size is returned in nBlobSize.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is too small; the required size is returned in nBlobSize.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ESMTH_LOAD(), NDK_ESMTH_INIT()
+  */
+  int   __stdcall NDK_ESMTH_SAVE( NDK_HANDLE hModel,  ///< [in] is the handle of the model (see NDK_ESMTH_INIT()).
+                                  BYTE* pBlob,        ///< [out, optional] is the output buffer of the blob.
+                                  size_t* nBlobSize   ///< [inout] is the size of pBlob on input, and the size of the blob on output.
+                                  );
+
+  /*!
+  *   \brief Creates an exponential smoothing model from a binary blob (see NDK_ESMTH_SAVE()).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ESMTH_SAVE(), NDK_ESMTH_CLEANUP()
+  */
+  int   __stdcall NDK_ESMTH_LOAD( const BYTE* pBlob,  ///< [in] is the binary blob (see NDK_ESMTH_SAVE()).
+                                  size_t nBlobSize,   ///< [in] is the size of pBlob.
+                                  NDK_HANDLE* pHandle ///< [out] is the handle of the created model.
+                                  );
+
+  /*!
+  *   \brief Releases an exponential smoothing model, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ESMTH_INIT(), NDK_ESMTH_LOAD()
+  */
+  int   __stdcall NDK_ESMTH_CLEANUP(NDK_HANDLE hModel ///< [in] is the handle of the model (see NDK_ESMTH_INIT()).
+                                    );
+
+  /*!
+  *   \brief Returns the optimal smoothing factors of an exponential smoothing model (simple, double, linear or triple) for many time series in one call.
+  *   \note 1. The time series may have different lengths, and (for the triple exponential smoothing) different season lengths.
+  *   \note 2. The optimal factors minimize the sum of squared one-step errors (SSE), as NDK_SESMTH(), NDK_DESMTH(), NDK_LESMTH() and NDK_TESMTH() do with bOptimize=TRUE.
+  *   \note 3. The recursions of several series are evaluated together in a pack, one series per SIMD lane, so each SSE evaluation of a pack costs about the same as for a single series.
+  *            The series of a pack may have different lengths: the shorter series are padded at the end, and the padded steps are masked out (they update neither the state nor the SSE).
+  *            The series are sorted by length before packing (and, for the triple exponential smoothing, by season length), so a ragged panel still fills every lane with few padded steps.
+  *   \note 4. The packs are distributed across up to nThreads workers by a work-stealing scheduler, so the packs of uneven lengths keep every worker busy.
+  *   \note 5. On input, alphas, betas and gammas hold the initial values (or NaN to use the default); on output, they hold the optimal values. 
+  *            The factors not used by the model (e.g. beta for the simple exponential smoothing) may be NULL.
+  *   \note 6. A series that cannot be optimized (e.g. fewer than two seasons of observations for the triple exponential smoothing) gets NaN factors and SSE, 
+  *            and its error code in pStatus; its lane is masked out, and the other series of its pack are still optimized.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful for one or more time series (see pStatus and \ref SFMacros.h)
+  *   \sa NDK_SESMTH(), NDK_DESMTH(), NDK_LESMTH(), NDK_TESMTH()
+  */
+  int   __stdcall NDK_ESMTH_PARAM_BATCH(double** pData,         ///< [in] is the array of univariate time series data (one column per time series).
+                                        const size_t* nSizes,   ///< [in] is the number of observations in each time series (an array of nSeries elements).
+                                        size_t nSeries,         ///< [in] is the number of time series.
+                                        BOOL bAscending,        ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                        ESMTH_MODEL_TYPE model, ///< [in] is the exponential smoothing model (see #ESMTH_MODEL_TYPE).
+                                        const int* L,           ///< [in, optional] is the season length of each time series (an array of nSeries elements). It is required for the triple exponential smoothing only.
+                                        double* alphas,         ///< [inout] is the data smoothing factor of each time series (an array of nSeries elements).
+                                        double* betas,          ///< [inout, optional] is the trend smoothing factor of each time series (an array of nSeries elements).
+                                        double* gammas,         ///< [inout, optional] is the seasonal change smoothing factor of each time series (an array of nSeries elements).
+                                        size_t nThreads,        ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                        double* retSSE,         ///< [out, optional] is the sum of squared one-step errors of each time series at the optimal factors (an array of nSeries elements).
+                                        int* pStatus            ///< [out, optional] is the status code of each time series (an array of nSeries elements). If NULL, it is not returned.
+                                        );
+
+  /*!
+  *   \brief Returns the weighted moving average of every observation, and its forecasts for the horizons 1 to nHorizon, in one pass.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_WMA() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. The weights are inspected once to select the algorithm:
+  *             - Uniform weights (a single window size, or equal weights): a running sum, \f$O(N)\f$ regardless of the window size.
+  *             - Linear weights (an arithmetic progression): a pair of running sums (plain and weighted), \f$O(N)\f$ regardless of the window size.
+  *             - Other weights: an FFT (overlap-save) convolution for large windows (64 weights or more), \f$O(N \log W)\f$, or a direct convolution for smaller windows.
+  *   \note 3. The running sums are re-anchored (recomputed from scratch) every W observations to bound the accumulated rounding error.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_WMA(), NDK_SESMTH_SERIES(), NDK_DESMTH_SERIES(), NDK_LESMTH_SERIES(), NDK_TESMTH_SERIES(), NDK_GESMTH_SERIES()
+  */
+  int   __stdcall NDK_WMA_SERIES( double *pData,      ///< [in] is the univariate time series data (a one dimensional array).
+                                  size_t nSize,       ///< [in] is the number of elements in pData.
+                                  BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)). 
+                                  double* weights,    ///< [in] is the size of the equal-weighted window or an array of multiplying factors (i.e. weights) of the moving/rolling window. 
+                                  size_t nwSize,      ///< [in] is the number of elements in the weights array.
+                                  size_t nHorizon,    ///< [in] is the number of forecast steps beyond the end of X.
+                                  double* retVals,    ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                  size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                  );
+
+  /*!
+  *   \brief Returns the weighted moving average of every observation for many time series (columns of a panel) in one call.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. Each column is computed as in NDK_WMA_SERIES() (with nHorizon=0), so the algorithm (running sums or FFT convolution) is selected once, 
+  *            and the FFT of the weights is computed once and shared by every column.
+  *   \note 3. The columns are processed independently and in parallel (up to nThreads workers).
+  *   \note 4. The output has the same layout as XX (one array per column), so every worker only writes to the arrays of its own columns.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output arrays are smaller than N (nOutSize < N); nothing is computed.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_WMA(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_WMA_PANEL(double** XX,        ///< [in] is the panel (multivariate time series) matrix data (two dimensional).
+                                size_t N,           ///< [in] is the number of observations (rows) in XX.
+                                size_t M,           ///< [in] is the number of time series (columns) in XX.
+                                BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)). 
+                                double* weights,    ///< [in] is the size of the equal-weighted window or an array of multiplying factors (i.e. weights) of the moving/rolling window. 
+                                size_t nwSize,      ///< [in] is the number of elements in the weights array.
+                                size_t nThreads,    ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                double** retVals,   ///< [out] is the weighted moving average of every observation (M arrays of nOutSize elements, same layout as XX).
+                                size_t nOutSize     ///< [in] is the number of elements in each array of retVals (no less than N).
+                                );
+
+  /*!
+  *   \brief Returns the (Brown's) simple exponential smoothing of every observation, and its forecasts for the horizons 1 to nHorizon, in one recursion.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_SESMTH() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. If bOptimize is TRUE, the smoothing factor is optimized once, and the series is computed with the optimal value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SESMTH(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_SESMTH_SERIES(double *pData,      ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t nSize,       ///< [in] is the number of elements in pData.
+                                    BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                    double* alpha,      ///< [inout] is the smoothing factor (alpha should be between zero and one (exclusive)). If missing or omitted, a value of 0.333 is used.
+                                    size_t nHorizon,    ///< [in] is the number of forecast steps beyond the end of X.
+                                    BOOL bOptimize,     ///< [in] is a flag (True/False) for searching and using the optimal value of the smoothing factor. If missing or omitted, optimize is assumed false.
+                                    double* retVals,    ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                    size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Returns the (Holt-Winter's) double exponential smoothing of every observation, and its forecasts for the horizons 1 to nHorizon, in one recursion.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_DESMTH() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. If bOptimize is TRUE, the smoothing factors are optimized once, and the series is computed with the optimal values.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_DESMTH(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_DESMTH_SERIES(double *pData,      ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t nSize,       ///< [in] is the number of elements in pData.
+                                    BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                    double *alpha,      ///< [inout] is the data smoothing factor (alpha should be between zero and one (exclusive)).
+                                    double *beta,       ///< [inout] is the trend smoothing factor (beta should be between zero and one (exclusive)).
+                                    size_t nHorizon,    ///< [in] is the number of forecast steps beyond the end of X.
+                                    BOOL bOptimize,     ///< [in] is a flag (True/False) for searching and using the optimal value of the smoothing factor. If missing or omitted, optimize is assumed false. 
+                                    double* retVals,    ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                    size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Returns the (Brown's) linear exponential smoothing of every observation, and its forecasts for the horizons 1 to nHorizon, in one recursion.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_LESMTH() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. If bOptimize is TRUE, the smoothing factor is optimized once, and the series is computed with the optimal value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_LESMTH(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_LESMTH_SERIES(double *pData,      ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t nSize,       ///< [in] is the number of elements in pData.
+                                    BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                    double *alpha,      ///< [inout] is the smoothing factor (alpha should be between zero and one (exclusive)). If missing or omitted, a value of 0.333 is used.
+                                    size_t nHorizon,    ///< [in] is the number of forecast steps beyond the end of X.
+                                    BOOL bOptimize,     ///< [in] is a flag (True/False) for searching and using the optimal value of the smoothing factor. If missing or omitted, optimize is assumed false. 
+                                    double* retVals,    ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                    size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Returns the (Winters's) triple exponential smoothing of every observation, and its forecasts for the horizons 1 to nHorizon, in one recursion.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_TESMTH() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. If bOptimize is TRUE, the smoothing factors are optimized once, and the series is computed with the optimal values.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_TESMTH(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_TESMTH_SERIES(double *pData,      ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t nSize,       ///< [in] is the number of elements in pData.
+                                    BOOL bAscending,    ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                    double *alpha,      ///< [inout] is the data smoothing factor (alpha should be between zero and one (exclusive)).
+                                    double *beta,       ///< [inout] is the trend smoothing factor (beta should be between zero and one (exclusive)).
+                                    double *gamma,      ///< [inout] is the seasonal change smoothing factor (Gamma should be between zero and one (exclusive)).
+                                    int L,              ///< [in] is the season length.
+                                    size_t nHorizon,    ///< [in] is the number of forecast steps beyond the end of X.
+                                    BOOL bOptimize,     ///< [in] is a flag (True/False) for searching and using optimal value of the smoothing factor. If missing or omitted, optimize is assumed false. 
+                                    double* retVals,    ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                    size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Returns the generalized exponential smoothing of every observation, and its forecasts for the horizons 1 to nHorizon, in one recursion.
+  *   \note 1. The output holds nSize+nHorizon values in ascending time order: the in-sample values (i.e. NDK_GESMTH() with nHorizon=0 at each position), followed by the forecasts 1 to nHorizon.
+  *   \note 2. If bOptimize is TRUE, the smoothing factors are optimized once, and the series is computed with the optimal values.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nSize+nHorizon.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GESMTH(), NDK_WMA_SERIES()
+  */
+  int   __stdcall NDK_GESMTH_SERIES(double *pData,            ///< [in] is the univariate time series data (a one dimensional array).
+                                    size_t nSize,             ///< [in] is the number of elements in pData.
+                                    BOOL bAscending,          ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                    double *alpha,            ///< [inout] is the data smoothing factor (alpha should be between zero and one (exclusive)).
+                                    double *beta,             ///< [inout] is the trend smoothing factor (beta should be between zero and one (exclusive)).
+                                    double *gamma,            ///< [inout] is the seasonal change smoothing factor (Gamma should be between zero and one (exclusive)).
+                                    double *phi,              ///< [inout] is the damping coefficient for the trend.
+                                    double *lambda,           ///< [inout] is the coefficient value for the autocorrelation adjustment
+                                    WORD  TrendType,          ///< [in] is the type of trend in the model (0=none, 1=additive, 2- damped additive, 3=multiplicative, 4=damped multiplicative)
+                                    WORD  SeasonalityType,    ///< [in] is the type of seasonality in the modem (0=none, 1=additive, 2=multiplicative)
+                                    int seasonLength,         ///< [in] is the season length.
+                                    size_t nHorizon,          ///< [in] is the number of forecast steps beyond the end of X.
+                                    BOOL bOptimize,           ///< [in] is a flag (True/False) for searching and using optimal value of the smoothing factor. If missing or omitted, optimize is assumed false. 
+                                    BOOL bAutoCorrelationAdj, ///< [in] is a flag (True/False) for adding a correction term for the 1st ourder autocorrelation in the
+                                    BOOL bLogTransform,       ///< [in] is a flag (True/False) for applying natural log transform to the input data prior to smoothing.
+                                    double* retVals,          ///< [out] is the in-sample smoothed series followed by the forecasts (an array of nSize+nHorizon elements).
+                                    size_t nOutSize           ///< [in] is the number of elements in retVals.
+                                    );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Returns values along a trend curve (e.g. linear, quadratic, exponential, etc.) at time T+m.
   *   \return status code of the operation
@@ -2006,6 +3088,42 @@ extern "C"
                             double argAlpha,      ///< [in] is the statistical significance or confidence level (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
                             double* retVal        ///< [out] is the calculated value of this function.
                             );
+
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Fits a trend curve (e.g. linear, quadratic, exponential, etc.) to many equal-length time series (columns of a panel), and returns the forecasts at times T+1 to T+nHorizon.
+  *   \note 1. Each column in the input panel corresponds to a separate time series variable, and each row corresponds to an observation.
+  *   \note 2. The design matrix of the trend only depends on the number of observations, the trend type, the polynomial order and the intercept option. 
+  *            The design is analytic (a function of the time index), so only the triangular factor R of its QR factorization is kept, in a process-wide, 
+  *            thread-safe, least-recently-used (LRU) cache of 64 entries, so the panels of the same length reuse it. Only the designs with up to 8 coefficients are cached, 
+  *            so the cache holds at most 64 x 8 x 8 doubles (32 KB), regardless of N.
+  *   \note 3. The columns share the R factor, and the coefficients of all columns are found with one blocked matrix solve (\f$R^\top R\beta=X^\top Y\f$, 
+  *            with the design columns generated on the fly and Y holding the (transformed) columns), followed by one refinement step 
+  *            (corrected semi-normal equations) to recover the accuracy of the QR solve.
+  *   \note 4. A column with missing values is fitted separately, with its own design (not cached), as in NDK_TREND().
+  *   \note 5. The blocks of columns are processed in parallel (up to nThreads workers).
+  *   \note 6. A column that cannot be fitted (e.g. a non-positive value with the exponential, logarithmic or power trend) gets NaN forecasts and R-squared, 
+  *            and its error code in pStatus; it is dropped from the blocked solve, so the other columns are unaffected.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful for one or more time series (see pStatus and \ref SFMacros.h)
+  *   \sa NDK_TREND()
+  */
+  int   __stdcall NDK_TREND_PANEL(double** XX,          ///< [in] is the panel (multivariate time series) matrix data (two dimensional).
+                                  size_t N,             ///< [in] is the number of observations (rows) in XX.
+                                  size_t M,             ///< [in] is the number of time series (columns) in XX.
+                                  BOOL bAscending,      ///< [in] is the time order in the data series (i.e. the first data point's corresponding date (earliest date=1 (default), latest date=0)).
+                                  WORD nTrendType,      ///< [in] is the model description flag for the trend function (1=Linear, 2=Polynomial, 3=Exponential, 4=Logarithmic, 5=Power).
+                                  WORD argPolyOrder,    ///< [in] is the polynomial order. This is only relevant for a polynomial trend type and is ignored for all others. If missing, POrder = 1. 
+                                  BOOL AllowIntercep,   ///< [in] is a switch to include or exclude an intercept in the regression.
+                                  double InterceptVal,  ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                  size_t nHorizon,      ///< [in] is the number of forecast steps beyond the end of X.
+                                  size_t nThreads,      ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                  double* retVals,      ///< [out] is the table of the forecasts (M rows by nHorizon columns, row-major).
+                                  double* retRSQ,       ///< [out, optional] is the R-squared of each fit (an array of M elements). If NULL, it is not returned.
+                                  int* pStatus          ///< [out, optional] is the status code of each time series (an array of M elements). If NULL, it is not returned.
+                                  );
+#endif // NDK_PREVIEW_API
   ///@}
 
 
@@ -2173,44 +3291,459 @@ extern "C"
   *   \return status code of the operation
   *   \retval #NDK_SUCCESS Operation successful
   *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
-  *   \sa NDK_MLR_FORE(), NDK_MLR_PARAM(), NDK_MLR_ANOVA(), NDK_MLR_GOF, NDK_MLR_FITTED, NDK_MLR_STEPWISE
+  *   \sa NDK_MLR_FORE(), NDK_MLR_PARAM(), NDK_MLR_ANOVA(), NDK_MLR_GOF, NDK_MLR_FITTED, NDK_MLR_STEPWISE
+  */
+  int __stdcall	NDK_MLR_PRFTest ( double** X,         ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                  size_t nXSize,      ///< [in] is the number of observations (rows) in X.
+                                  size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
+                                  double* Y,          ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                  size_t nYSize,      ///< [in] is the number of observations in Y.
+                                  double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                  LPBYTE mask1,       ///< [in] is the boolean array to choose the explanatory variables in model 1. If missing, all variables in X are included.
+                                  size_t nMaskLen1,   ///< [in] is the number of elements in "mask1."
+                                  LPBYTE mask2,       ///< [in] is the boolean array to choose the explanatory variables in model 2. If missing, all variables in X are included.
+                                  size_t nMaskLen2,   ///< [in] is the number of elements in "mask2."
+                                  double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                  WORD nRetType,      ///< [in] is a switch to select the return output (1 = P-Value (default), 2 = Test Stats, 3 = Critical Value.) 
+                                  double* retVal      ///< [out] is the calculated test statistics/
+                                );
+
+  /*! 
+  *   \brief Returns a list of the selected variables after performing the stepwise regression.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_FORE(), NDK_MLR_PARAM(), NDK_MLR_ANOVA(), NDK_MLR_GOF, NDK_MLR_PRFTest, NDK_MLR_STEPWISE
+  */
+  int __stdcall	NDK_MLR_STEPWISE (double** X,         ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                  size_t nXSize,      ///< [in] is the number of observations (rows) in X.
+                                  size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
+                                  LPBYTE mask,        ///< [inout] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                  size_t nMaskLen,    ///< [in] is the number of elements in the "mask."
+                                  double* Y,          ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                  size_t nYSize,      ///< [in] is the number of observations in Y.
+                                  double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                  double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                  WORD nMode          ///< [in] is a switch to select the variable's inclusion/exclusion approach (1=forward selection (default), 2=backward elimination , 3=bi-directional elimination):
+                                                      /// 1. Forward selection
+                                                      /// 2. Bacward elemination
+                                                      /// 3. Bi-directional elemination
+                                  );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Calculates the OLS regression coefficients values; the explanatory variables are passed as a strided matrix view.
+  *   \note 1. This function is identical to NDK_MLR_PARAM(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \note 2. The number of observations and variables are taken from X->nRows and X->nCols, respectively.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_PARAM(), NDK_MLR_FORE_VIEW(), NDK_MLR_FITTED_VIEW(), NDK_MLR_ANOVA_VIEW(), NDK_MLR_GOF_VIEW()
+  */
+  int __stdcall	NDK_MLR_PARAM_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                    LPBYTE mask,          ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array of cells).
+                                    size_t nYSize,        ///< [in] is the number of observations in Y.
+                                    double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                    WORD nRetType,        ///< [in] is a switch to select the return output (1=value (default), 2=std. error, 3=t-stat, 4=P-value, 5=upper limit (CI), 6=lower limit (CI)).
+                                    WORD nParamIndex,     ///< [in] is a switch to designate the target parameter (0=intercept (default), 1=first variable, 2=2nd variable, etc.).
+                                    double* retVal        ///< [out] is the computed statistics of the regression coefficient.
+                                    );
+
+  /*!
+  *   \brief Calculates the forecast mean, error and confidence interval; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_FORE(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_FORE(), NDK_MLR_PARAM_VIEW(), NDK_MLR_FITTED_VIEW(), NDK_MLR_ANOVA_VIEW(), NDK_MLR_GOF_VIEW()
+  */
+  int __stdcall	NDK_MLR_FORE_VIEW (const MATRIX_VIEW* X,  ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                    LPBYTE mask,          ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array of cells).
+                                    size_t nYSize,        ///< [in] is the number of observations in Y.
+                                    double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                    double* target,       ///< [in] is the value of the explanatory variables (a one dimensional array).
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                    WORD nRetType,        ///< [in] is a switch to select the return output (1=forecast (default), 2=error, 3=upper limit, 4=lower limit).
+                                    double* retVal        ///< [out] is the computed forecast statistics.
+                                    );
+
+  /*!
+  *   \brief Returns the fitted values of the conditional mean, residuals or leverage measures; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_FITTED(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_FITTED(), NDK_MLR_PARAM_VIEW(), NDK_MLR_FORE_VIEW(), NDK_MLR_ANOVA_VIEW(), NDK_MLR_GOF_VIEW()
+  */
+  int __stdcall	NDK_MLR_FITTED_VIEW (const MATRIX_VIEW* X,  ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                      LPBYTE mask,          ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                      size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                      double* Y,            ///< [inout] is the response or dependent variable data array (one dimensional array of cells).
+                                      size_t nYSize,        ///< [in] is the number of observations in Y.
+                                      double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                      WORD nRetType         ///< [in] is a switch to select the return output (1=fitted values (default), 2=residuals, 3=standardized residuals, 4=leverage, 5=Cook's distance).
+                                      );
+
+  /*!
+  *   \brief Calculates the regression model analysis of the variance (ANOVA) values; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_ANOVA(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_ANOVA(), NDK_MLR_PARAM_VIEW(), NDK_MLR_FORE_VIEW(), NDK_MLR_FITTED_VIEW(), NDK_MLR_GOF_VIEW()
+  */
+  int __stdcall	NDK_MLR_ANOVA_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                    LPBYTE mask,          ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                    double* Y,            ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                    size_t nYSize,        ///< [in] is the number of observations in Y.
+                                    double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                    WORD nRetType,        ///< [in] is a switch to select the output (1=SSR (default), 2=SSE, 3=SST, 4=MSR, 5=MSE, 6=F-stat, 7=P-value).
+                                    double* retVal        ///< [out] is the calculated statistics ANOVA output.
+                                    );
+
+  /*!
+  *   \brief Calculates a measure for the goodness of fit (e.g. R^2); the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_GOF(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_GOF(), NDK_MLR_PARAM_VIEW(), NDK_MLR_FORE_VIEW(), NDK_MLR_FITTED_VIEW(), NDK_MLR_ANOVA_VIEW()
+  */
+  int __stdcall	NDK_MLR_GOF_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                  LPBYTE mask,          ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                  size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                  double* Y,            ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                  size_t nYSize,        ///< [in] is the number of observations in Y.
+                                  double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                  WORD nRetType,        ///< [in] is a switch to select a fitness measure (1=R-square (default), 2=adjusted R-square, 3=RMSE, 4=LLF, 5=AIC, 6=BIC/SIC).
+                                  double* retVal        ///< [out] is the calculated goodness-of-fit statistics.
+                                  );
+
+  /*!
+  *   \brief Calculates the p-value and related statistics of the partial f-test; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_PRFTest(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_PRFTest(), NDK_MLR_PARAM_VIEW(), NDK_MLR_STEPWISE_VIEW()
+  */
+  int __stdcall	NDK_MLR_PRFTest_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                      double* Y,            ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                      size_t nYSize,        ///< [in] is the number of observations in Y.
+                                      double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                      LPBYTE mask1,         ///< [in] is the boolean array to choose the explanatory variables in model 1. If missing, all variables in X are included.
+                                      size_t nMaskLen1,     ///< [in] is the number of elements in "mask1."
+                                      LPBYTE mask2,         ///< [in] is the boolean array to choose the explanatory variables in model 2. If missing, all variables in X are included.
+                                      size_t nMaskLen2,     ///< [in] is the number of elements in "mask2."
+                                      double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                      WORD nRetType,        ///< [in] is a switch to select the return output (1 = P-Value (default), 2 = Test Stats, 3 = Critical Value.)
+                                      double* retVal        ///< [out] is the calculated test statistics.
+                                      );
+
+  /*!
+  *   \brief Returns a list of the selected variables after performing the stepwise regression; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_MLR_STEPWISE(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_STEPWISE(), NDK_MLR_PARAM_VIEW(), NDK_MLR_PRFTest_VIEW()
+  */
+  int __stdcall	NDK_MLR_STEPWISE_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                      LPBYTE mask,          ///< [inout] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                      size_t nMaskLen,      ///< [in] is the number of elements in the "mask."
+                                      double* Y,            ///< [in] is the response or dependent variable data array (one dimensional array of cells).
+                                      size_t nYSize,        ///< [in] is the number of observations in Y.
+                                      double intercept,     ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                      double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                      WORD nMode            ///< [in] is a switch to select the variable's inclusion/exclusion approach (1=forward selection (default), 2=backward elimination, 3=bi-directional elimination).
+                                      );
+
+  /*!
+  *   \brief Creates a multiple linear regression (MLR) model: the regression is fitted (factorized) once, and every statistic is answered from the cached decomposition.
+  *   \note 1. The model is released by NDK_MLR_MODEL_CLEANUP().
+  *   \note 2. The design (the variables selected by the mask, and the intercept) is factorized with a blocked Householder QR with column pivoting. 
+  *            For tall data, the rows are split into panels that are factorized in parallel (up to nThreads workers) and merged (TSQR).
+  *   \note 3. The model keeps the factorization, the coefficients, the residuals and the leverage factors, so X and Y may be released after the call.
+  *   \note 4. The statistics are the same (up to rounding) as those returned by NDK_MLR_PARAM(), NDK_MLR_FORE(), NDK_MLR_FITTED(), NDK_MLR_ANOVA(), NDK_MLR_GOF() and NDK_MLR_PRFTest() for the same input.
+  *   \note 5. NDK_REGRESSION() does not use the model: its design has a single regressor (at most POrder+1 columns), so refitting it is cheaper than keeping a handle.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_MODEL_PARAM(), NDK_MLR_MODEL_FORE(), NDK_MLR_MODEL_FITTED(), NDK_MLR_MODEL_ANOVA(), NDK_MLR_MODEL_GOF(), NDK_MLR_MODEL_PRFTest(), NDK_MLR_MODEL_CLEANUP()
+  */
+  int __stdcall	NDK_MLR_MODEL_INIT (double** X,         ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                    size_t nXSize,      ///< [in] is the number of observations (rows) in X.
+                                    size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
+                                    LPBYTE mask,        ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                    size_t nMaskLen,    ///< [in] is the number of elements in the "mask."
+                                    double* Y,          ///< [in] is the response or the dependent variable data array (one dimensional array of cells).
+                                    size_t nYSize,      ///< [in] is the number of observations in Y.
+                                    double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                    size_t nThreads,    ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                    NDK_HANDLE* pHandle ///< [out] is the handle of the created model.
+                                    );
+
+  /*!
+  *   \brief Returns all the statistics (value, std. error, t-stat, p-value and confidence interval) of all the regression coefficients in one call.
+  *   \note 1. The output table holds one row per coefficient (the intercept first, then the variables of X in order) and six columns, in the order of nRetType of NDK_MLR_PARAM(): 
+  *            value, std. error, t-stat, p-value, upper limit and lower limit.
+  *   \note 2. The rows of the variables excluded by the mask are set to missing (NaN).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than (nXVars+1) x 6.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_PARAM(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_PARAM(NDK_HANDLE hModel,  ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                    double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                    double* retVals,    ///< [out] is the table of the coefficients' statistics ((nXVars+1) rows by 6 columns, row-major).
+                                    size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Calculates the forecast mean, error and confidence interval for one or more values of the explanatory variables.
+  *   \note The output table holds one row per target and four columns, in the order of nRetType of NDK_MLR_FORE(): forecast, std. error, upper limit and lower limit.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nTargets x 4; nothing is computed.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_FORE(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_FORE (NDK_HANDLE hModel,    ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                    const double* target, ///< [in] is the values of the explanatory variables (nTargets rows by nXVars columns, row-major).
+                                    size_t nTargets,      ///< [in] is the number of rows in target.
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                    double* retVals,      ///< [out] is the table of the forecast statistics (nTargets rows by 4 columns, row-major).
+                                    size_t nOutSize       ///< [in] is the number of elements in retVals.
+                                    );
+
+  /*!
+  *   \brief Returns the fitted values of the conditional mean, residuals or leverage measures.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is smaller than nXSize (the number of observations of the model); nothing is computed.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_FITTED(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_FITTED (NDK_HANDLE hModel,  ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                      WORD nRetType,      ///< [in] is a switch to select the return output (1=fitted values (default), 2=residuals, 3=standardized residuals, 4=leverage, 5=Cook's distance).
+                                      double* retVals,    ///< [out] is the calculated values (an array of nXSize elements).
+                                      size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                      );
+
+  /*!
+  *   \brief Returns all the regression model analysis of the variance (ANOVA) values in one call.
+  *   \note The output holds seven values, in the order of nRetType of NDK_MLR_ANOVA(): SSR, SSE, SST, MSR, MSE, F-stat and P-value.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_ANOVA(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_ANOVA (NDK_HANDLE hModel,   ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                     double* retVals      ///< [out] is the ANOVA values (an array of 7 elements).
+                                     );
+
+  /*!
+  *   \brief Returns all the goodness of fit measures in one call.
+  *   \note The output holds six values, in the order of nRetType of NDK_MLR_GOF(): R-square, adjusted R-square, RMSE, LLF, AIC and BIC/SIC.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_GOF(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_GOF (NDK_HANDLE hModel,   ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                   double* retVals      ///< [out] is the goodness-of-fit measures (an array of 6 elements).
+                                   );
+
+  /*!
+  *   \brief Calculates the partial f-test of the model against a reduced model (a subset of its variables).
+  *   \note The reduced model is obtained by deleting columns from the cached factorization (Givens rotations), so the data is not refitted.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_PRFTest(), NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_PRFTest (NDK_HANDLE hModel, ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                       LPBYTE mask,       ///< [in] is the boolean array to choose the explanatory variables in the reduced model. It must be a subset of the model's mask.
+                                       size_t nMaskLen,   ///< [in] is the number of elements in the "mask."
+                                       double alpha,      ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                       WORD nRetType,     ///< [in] is a switch to select the return output (1 = P-Value (default), 2 = Test Stats, 3 = Critical Value.) 
+                                       double* retVal     ///< [out] is the calculated test statistics.
+                                       );
+
+  /*!
+  *   \brief Releases a multiple linear regression model, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_MODEL_INIT()
+  */
+  int __stdcall	NDK_MLR_MODEL_CLEANUP (NDK_HANDLE hModel  ///< [in] is the handle of the model (see NDK_MLR_MODEL_INIT()).
+                                       );
+
+  /*!
+  *   \brief Creates an out-of-core (chunked) multiple linear regression: the observations are pushed in blocks of rows, and only a compact summary of the data is kept.
+  *   \note 1. The state is the triangular factor R of the augmented design \f$[1\ X\ Y]\f$ (TSQR), and the count, mean and sum of squared deviations (M2) of Y, 
+  *            so its memory is \f$O(k^2)\f$ regardless of the number of rows. The raw sums of Y and \f$Y^2\f$ are not kept, as they lose precision (cancellation) for large counts.
+  *   \note 2. Since the first column of the design is the constant, the trailing block of R (without its first row and column) is the R factor of the centered \f$[X\ Y]\f$, 
+  *            so the centered cross-products (and the covariance matrix used by NDK_PCR_CHUNK_FINAL()) are recovered without cancellation.
+  *   \note 3. The state is released by NDK_MLR_CHUNK_CLEANUP().
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_PUSH(), NDK_MLR_CHUNK_MERGE(), NDK_MLR_CHUNK_FINAL(), NDK_PCR_CHUNK_FINAL(), NDK_MLR_CHUNK_SAVE(), NDK_MLR_CHUNK_LOAD(), NDK_MLR_CHUNK_CLEANUP()
+  */
+  int __stdcall	NDK_MLR_CHUNK_INIT (size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
+                                    LPBYTE mask,        ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                    size_t nMaskLen,    ///< [in] is the number of elements in the "mask."
+                                    double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                    NDK_HANDLE* pHandle ///< [out] is the handle of the created state.
+                                    );
+
+  /*!
+  *   \brief Accumulates a block of observations (rows) into an out-of-core regression state.
+  *   \note 1. The block is factorized (QR) and stacked onto the current R factor, which is then re-triangularized; the block itself is not kept.
+  *   \note 2. The count, mean and M2 of the block's Y are computed in two passes over the block, and merged into the state with Chan's pairwise formula: 
+  *            \f$n=n_a+n_b\f$, \f$\delta=\bar y_b-\bar y_a\f$, \f$\bar y=\bar y_a+\delta n_b/n\f$ and \f$M_2=M_{2,a}+M_{2,b}+\delta^2 n_a n_b/n\f$.
+  *   \note 3. The rows with a missing value (in X or Y) are dropped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_INIT(), NDK_MLR_CHUNK_FINAL()
+  */
+  int __stdcall	NDK_MLR_CHUNK_PUSH (NDK_HANDLE hState,    ///< [in] is the handle of the state (see NDK_MLR_CHUNK_INIT()).
+                                    const MATRIX_VIEW* X, ///< [in] is the strided view of the block of the explanatory variables (nXVars columns).
+                                    const double* Y       ///< [in] is the response of the block (an array of X->nRows elements).
+                                    );
+
+  /*!
+  *   \brief Merges the state of one out-of-core regression into another (e.g. the partial states of several workers or processes).
+  *   \note 1. The two R factors are stacked and re-triangularized, and the counts, means and M2 of Y are merged with Chan's pairwise formula (see NDK_MLR_CHUNK_PUSH()), 
+  *            so the merged state is the same (up to rounding) as if all the rows had been pushed into one state.
+  *   \note 2. The two states must have the same number of variables, mask and intercept option. The source state is not modified.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_INIT(), NDK_MLR_CHUNK_LOAD()
+  */
+  int __stdcall	NDK_MLR_CHUNK_MERGE (NDK_HANDLE hState,   ///< [inout] is the handle of the destination state.
+                                     NDK_HANDLE hSource   ///< [in] is the handle of the state to merge into hState.
+                                     );
+
+  /*!
+  *   \brief Serializes an out-of-core regression state into a binary blob (e.g. to send a partial state to another process).
+  *   \note If pBlob is NULL, the required size is returned in nBlobSize.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffer is too small; the required size is returned in nBlobSize.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_LOAD(), NDK_MLR_CHUNK_MERGE()
+  */
+  int __stdcall	NDK_MLR_CHUNK_SAVE (NDK_HANDLE hState,  ///< [in] is the handle of the state (see NDK_MLR_CHUNK_INIT()).
+                                    BYTE* pBlob,        ///< [out, optional] is the output buffer of the blob.
+                                    size_t* nBlobSize   ///< [inout] is the size of pBlob on input, and the size of the blob on output.
+                                    );
+
+  /*!
+  *   \brief Creates an out-of-core regression state from a binary blob (see NDK_MLR_CHUNK_SAVE()).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_SAVE(), NDK_MLR_CHUNK_MERGE()
+  */
+  int __stdcall	NDK_MLR_CHUNK_LOAD (const BYTE* pBlob,  ///< [in] is the binary blob (see NDK_MLR_CHUNK_SAVE()).
+                                    size_t nBlobSize,   ///< [in] is the size of pBlob.
+                                    NDK_HANDLE* pHandle ///< [out] is the handle of the created state.
+                                    );
+
+  /*!
+  *   \brief Returns the regression coefficients, the ANOVA values and the goodness of fit measures of an out-of-core regression state.
+  *   \note 1. The coefficients table has the same layout as NDK_MLR_MODEL_PARAM(); the ANOVA values and the goodness of fit measures have the same layout as 
+  *            NDK_MLR_MODEL_ANOVA() and NDK_MLR_MODEL_GOF(), respectively.
+  *   \note 2. The state is not modified, so more blocks may be pushed afterwards.
+  *   \note 3. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_INIT(), NDK_MLR_ANOVA(), NDK_MLR_MODEL_PARAM()
   */
-  int __stdcall	NDK_MLR_PRFTest ( double** X,         ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
-                                  size_t nXSize,      ///< [in] is the number of observations (rows) in X.
-                                  size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
-                                  double* Y,          ///< [in] is the response or dependent variable data array (one dimensional array of cells).
-                                  size_t nYSize,      ///< [in] is the number of observations in Y.
-                                  double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
-                                  LPBYTE mask1,       ///< [in] is the boolean array to choose the explanatory variables in model 1. If missing, all variables in X are included.
-                                  size_t nMaskLen1,   ///< [in] is the number of elements in "mask1."
-                                  LPBYTE mask2,       ///< [in] is the boolean array to choose the explanatory variables in model 2. If missing, all variables in X are included.
-                                  size_t nMaskLen2,   ///< [in] is the number of elements in "mask2."
-                                  double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
-                                  WORD nRetType,      ///< [in] is a switch to select the return output (1 = P-Value (default), 2 = Test Stats, 3 = Critical Value.) 
-                                  double* retVal      ///< [out] is the calculated test statistics/
-                                );
+  int __stdcall	NDK_MLR_CHUNK_FINAL (NDK_HANDLE hState,   ///< [in] is the handle of the state (see NDK_MLR_CHUNK_INIT()).
+                                     double alpha,        ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                     double* retParams,   ///< [out, optional] is the table of the coefficients' statistics ((nXVars+1) rows by 6 columns, row-major).
+                                     double* retANOVA,    ///< [out, optional] is the ANOVA values (an array of 7 elements).
+                                     double* retGOF       ///< [out, optional] is the goodness-of-fit measures (an array of 6 elements).
+                                     );
 
-  /*! 
-  *   \brief Returns a list of the selected variables after performing the stepwise regression.
+  /*!
+  *   \brief Releases an out-of-core regression state, and all the resources it holds.
   *   \return status code of the operation
   *   \retval #NDK_SUCCESS Operation successful
   *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
-  *   \sa NDK_MLR_FORE(), NDK_MLR_PARAM(), NDK_MLR_ANOVA(), NDK_MLR_GOF, NDK_MLR_PRFTest, NDK_MLR_STEPWISE
+  *   \sa NDK_MLR_CHUNK_INIT(), NDK_MLR_CHUNK_LOAD()
   */
-  int __stdcall	NDK_MLR_STEPWISE (double** X,         ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
-                                  size_t nXSize,      ///< [in] is the number of observations (rows) in X.
-                                  size_t nXVars,      ///< [in] is the number of independent (explanatory) variables (columns) in X.
-                                  LPBYTE mask,        ///< [inout] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
-                                  size_t nMaskLen,    ///< [in] is the number of elements in the "mask."
-                                  double* Y,          ///< [in] is the response or dependent variable data array (one dimensional array of cells).
-                                  size_t nYSize,      ///< [in] is the number of observations in Y.
-                                  double intercept,   ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
-                                  double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
-                                  WORD nMode          ///< [in] is a switch to select the variable's inclusion/exclusion approach (1=forward selection (default), 2=backward elimination , 3=bi-directional elimination):
-                                                      /// 1. Forward selection
-                                                      /// 2. Bacward elemination
-                                                      /// 3. Bi-directional elemination
-                                  );
+  int __stdcall	NDK_MLR_CHUNK_CLEANUP (NDK_HANDLE hState  ///< [in] is the handle of the state (see NDK_MLR_CHUNK_INIT()).
+                                       );
+
+  /*!
+  *   \brief Returns the principal component regression (PCR) coefficients, the ANOVA values and the goodness of fit measures of an out-of-core regression state.
+  *   \note 1. PCR only needs the centered cross-products of \f$[X\ Y]\f$, and \f$X^\top X = R^\top R\f$: the covariance matrix of X and the covariances of X with Y are 
+  *            recovered from the trailing block of the state's R factor (see NDK_MLR_CHUNK_INIT()), without another pass over the data.
+  *   \note 2. The principal components are the eigenvectors of the covariance matrix of the selected variables; the fit is the same (up to rounding) as NDK_PCR_PARAM(), 
+  *            NDK_PCR_ANOVA() and NDK_PCR_GOF() on all the pushed rows.
+  *   \note 3. The outputs have the same layout as NDK_MLR_CHUNK_FINAL(), and the coefficients are expressed in terms of the original variables.
+  *   \note 4. The state is not modified, so more blocks may be pushed afterwards. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_MLR_CHUNK_INIT(), NDK_MLR_CHUNK_FINAL(), NDK_PCR_PARAM()
+  */
+  int __stdcall	NDK_PCR_CHUNK_FINAL (NDK_HANDLE hState,   ///< [in] is the handle of the state (see NDK_MLR_CHUNK_INIT()).
+                                     double alpha,        ///< [in] is the statistical significance of the test (i.e. alpha). If missing or omitted, an alpha value of 5% is assumed.
+                                     double* retParams,   ///< [out, optional] is the table of the coefficients' statistics ((nXVars+1) rows by 6 columns, row-major).
+                                     double* retANOVA,    ///< [out, optional] is the ANOVA values (an array of 7 elements).
+                                     double* retGOF       ///< [out, optional] is the goodness-of-fit measures (an array of 6 elements).
+                                     );
+
+  /*!
+  *   \brief Calculates the elastic net (penalized least squares) regression coefficients along a path of penalty values, with optional cross-validation.
+  *   \note 1. For each penalty \f$\lambda\f$, the coefficients minimize \f$\frac{1}{2n}\|y-\beta_0-X\beta\|^2 + \lambda\left(\frac{1-a}{2}\|\beta\|_2^2 + a\|\beta\|_1\right)\f$, where a is the l1Ratio option.
+  *   \note 2. The path is solved by coordinate descent with covariance updates (the inner products \f$x_j^\top x_k\f$ are computed once, for the variables that become active), 
+  *            from the largest to the smallest penalty, each fit starting from the previous solution (warm start).
+  *   \note 3. At each penalty, the sequential strong rules discard the variables that are likely to stay at zero; the discarded variables are checked (KKT conditions) after convergence, 
+  *            and added back if violated, so the solution is exact.
+  *   \note 4. The cross-validation folds are fitted independently and in parallel (up to nThreads workers); the best index is the penalty with the lowest mean squared CV error. 
+  *            With nFolds=0, no cross-validation is run: only the path (lambdas and retBetas) is computed, and retCVError, retCVStdError and nBestIndex are left untouched. 
+  *            nFolds=1 (or more folds than observations) is invalid: the function fails, and no output is modified.
+  *   \note 5. The mask and the intercept follow the conventions of NDK_MLR_PARAM(): the variables excluded by the mask are not fitted (their coefficients are set to missing (NaN)), 
+  *            and a fixed intercept value is subtracted from Y and not penalized.
+  *   \note 6. A missing output buffer (NULL) is skipped.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (e.g. nFolds=1) (see \ref SFMacros.h)
+  *   \sa NDK_MLR_PARAM(), NDK_PCR_PARAM(), NDK_COLNRTY_TEST()
+  */
+  int __stdcall	NDK_MLR_ENET_PATH (double** X,                    ///< [in] is the independent (explanatory) variables data matrix, such that each column represents one variable.
+                                   size_t nXSize,                 ///< [in] is the number of observations (rows) in X.
+                                   size_t nXVars,                 ///< [in] is the number of independent (explanatory) variables (columns) in X.
+                                   LPBYTE mask,                   ///< [in] is the boolean array to choose the explanatory variables in the model. If missing, all variables in X are included.
+                                   size_t nMaskLen,               ///< [in] is the number of elements in the "mask."
+                                   double* Y,                     ///< [in] is the response or the dependent variable data array (one dimensional array of cells).
+                                   size_t nYSize,                 ///< [in] is the number of observations in Y.
+                                   double intercept,              ///< [in] is the constant or intercept value to fix (e.g. zero). If missing (i.e. NaN), an intercept will not be fixed and is computed normally.
+                                   const ENET_OPTIONS* pOptions,  ///< [in] is the penalty, path, cross-validation and solver options (see #ENET_OPTIONS).
+                                   double* lambdas,               ///< [inout] is the penalty values of the path (an array of pOptions->nLambdas elements). If the first element is missing (NaN), the path is computed and returned.
+                                   double* retBetas,              ///< [out, optional] is the table of the coefficients (nLambdas rows by nXVars+1 columns (intercept first), row-major).
+                                   double* retCVError,            ///< [out, optional] is the mean squared cross-validation error of each penalty (an array of nLambdas elements).
+                                   double* retCVStdError,         ///< [out, optional] is the standard error of the cross-validation error of each penalty (an array of nLambdas elements).
+                                   size_t* nBestIndex             ///< [out, optional] is the (zero-based) index of the penalty with the lowest cross-validation error.
+                                   );
+#endif // NDK_PREVIEW_API
   ///@}
 
 
@@ -2431,6 +3964,283 @@ extern "C"
                                                       /// 2. Bacward elemination
                                                       /// 3. Bi-directional elemination
                                   );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  *   \brief Returns an array of cells for the i-th principal component (or residuals); the input variables are passed as a strided matrix view.
+  *   \note 1. This function is identical to NDK_PCA_COMP(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \note 2. The number of observations and variables are taken from X->nRows and X->nCols, respectively.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCA_COMP(), NDK_PCA_VAR_VIEW(), NDK_PCR_PARAM_VIEW()
+  */
+  int __stdcall	NDK_PCA_COMP_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                  LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                  size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                  WORD standardize,     ///< [in] is a flag or switch to standardize the input variables prior to the analysis (1 = standardize, 2 = subtract mean).
+                                  WORD nCompIndex,      ///< [in] is the component number to return.
+                                  WORD retType,         ///< [in] is a switch to select the return output (1 = proportion of variance, 2 = variance, 3 = eigenvalue, 4 = loadings, 5 = principal component data).
+                                  double* retVal,       ///< [out] is the calculated value or data
+                                  size_t nOutSize       ///< [in] is the size of retVal
+                                  );
+
+  /*!
+  *   \brief Returns an array of cells for the fitted values of the i-th input variable; the input variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCA_VAR(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCA_VAR(), NDK_PCA_COMP_VIEW(), NDK_PCR_PARAM_VIEW()
+  */
+  int __stdcall	NDK_PCA_VAR_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                  LPBYTE varMask,       ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                  size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                  WORD standardize,     ///< [in] is a flag or switch to standardize the input variables prior to the analysis (1 = standardize, 2 = subtract mean).
+                                  WORD nVarIndex,       ///< [in] is  the input variable number
+                                  WORD wMaxPC,          ///< [in] is the number of principal components (PC) to include
+                                  WORD retType,         ///< [in] is a switch to select the return output (1 = final communality, 2 = loading/weights, 3 = fitted values, 4 = residuals).
+                                  double* retVal,       ///< [out] is the calculated value or data
+                                  size_t nOutSize       ///< [in] is the size of retVal
+                                  );
+
+  /*!
+  *   \brief Calculates the regression coefficients values for a given input variable; the explanatory variables are passed as a strided matrix view.
+  *   \note 1. This function is identical to NDK_PCR_PARAM(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \note 2. The number of observations and variables are taken from X->nRows and X->nCols, respectively.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_PARAM(), NDK_PCR_FORE_VIEW(), NDK_PCR_FITTED_VIEW(), NDK_PCR_ANOVA_VIEW(), NDK_PCR_GOF_VIEW()
+  */
+  int __stdcall	NDK_PCR_PARAM_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nYSize,        ///< [in] is the number of elements in Y
+                                    double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha)
+                                    WORD nRetType,        ///< [in] is a switch to select the return output (1=value (default), 2=std. error, 3=t-stat, 4=P-value, 5=upper limit (CI), 6=lower limit (CI)).
+                                    WORD nParamIndex,     ///< [in] is a switch to designate the target parameter (0 = intercept (default), 1 = first variable, 2 = 2nd variable, etc.).
+                                    double* retVal        ///< [out] is the calculated parameter value or statistics.
+                                    );
+
+  /*!
+  *   \brief Calculates the model's estimated values, std. errors and related statistics; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_FORE(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_FORE(), NDK_PCR_PARAM_VIEW(), NDK_PCR_FITTED_VIEW(), NDK_PCR_ANOVA_VIEW(), NDK_PCR_GOF_VIEW()
+  */
+  int __stdcall	NDK_PCR_FORE_VIEW (const MATRIX_VIEW* X,  ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nYSize,        ///< [in] is the number of elements in Y
+                                    double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                    double* target,       ///< [in] is the value of the explanatory variables (a one dimensional array)
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha)
+                                    WORD nRetType,        ///< [in] is a switch to select the return output (1 = forecast (default), 2 = error, 3 = upper limit, 4 = lower limit).
+                                    double* retVal        ///< [out] is the calculated forecast value or statistics.
+                                    );
+
+  /*!
+  *   \brief Returns the fitted values, residuals or leverage measures; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_FITTED(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_FITTED(), NDK_PCR_PARAM_VIEW(), NDK_PCR_FORE_VIEW(), NDK_PCR_ANOVA_VIEW(), NDK_PCR_GOF_VIEW()
+  */
+  int __stdcall	NDK_PCR_FITTED_VIEW (const MATRIX_VIEW* X,  ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                      LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                      size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                      double* Y,            ///< [inout] is the response or the dependent variable data array (one dimensional array)
+                                      size_t nYSize,        ///< [in] is the number of elements in Y
+                                      double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                      WORD nRetType         ///< [in] is a switch to select the return output (1=fitted values (default), 2=residuals, 3=standardized residuals, 4=leverage (H), 5=Cook's distance).
+                                      );
+
+  /*!
+  *   \brief Calculates the regression model analysis of the variance (ANOVA) values; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_ANOVA(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_ANOVA(), NDK_PCR_PARAM_VIEW(), NDK_PCR_FORE_VIEW(), NDK_PCR_FITTED_VIEW(), NDK_PCR_GOF_VIEW()
+  */
+  int __stdcall	NDK_PCR_ANOVA_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                    size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nYSize,        ///< [in] is the number of elements in Y
+                                    double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                    WORD nRetType,        ///< [in] is a switch to select the output (1=SSR (default), 2=SSE, 3=SST, 4=MSR, 5=MSE, 6=F-stat, 7=P-value).
+                                    double* retVal        ///< [out] is the calculated statistics ANOVA output.
+                                    );
+
+  /*!
+  *   \brief Calculates a measure for the goodness of fit (e.g. R^2); the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_GOF(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_GOF(), NDK_PCR_PARAM_VIEW(), NDK_PCR_FORE_VIEW(), NDK_PCR_FITTED_VIEW(), NDK_PCR_ANOVA_VIEW()
+  */
+  int __stdcall	NDK_PCR_GOF_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                  LPBYTE mask,          ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                  size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                  double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                  size_t nYSize,        ///< [in] is the number of elements in Y
+                                  double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                  WORD nRetType,        ///< [in] is a switch to select a fitness measure (1 = R-Square (default), 2 = Adjusted R Square, 3 = RMSE, 4 = LLF, 5 = AIC, 6 = BIC/SIC ).
+                                  double* retVal        ///< [out] is the calculated goodness of fit measure
+                                  );
+
+  /*!
+  *   \brief Calculates the p-value and related statistics of the partial f-test; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_PRFTest(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_PRFTest(), NDK_PCR_PARAM_VIEW(), NDK_PCR_STEPWISE_VIEW()
+  */
+  int __stdcall	NDK_PCR_PRFTest_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                      double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                      size_t nYSize,        ///< [in] is the number of elements in Y
+                                      double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                      LPBYTE mask1,         ///< [in] is the boolean array to select the input variables of model 1. If missing (i.e. NULL), all variables in X are included.
+                                      size_t nMaskLen1,     ///< [in] is the number of elements in mask1
+                                      LPBYTE mask2,         ///< [in] is the boolean array to select the input variables of model 2. If missing (i.e. NULL), all variables in X are included.
+                                      size_t nMaskLen2,     ///< [in] is the number of elements in mask2
+                                      double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha)
+                                      WORD nRetType,        ///< [in] is a switch to select the return output (1 = P-Value (default), 2 = Test Stats, 3 = Critical Value.)
+                                      double* retVal        ///< [out] is the calculated test statistics.
+                                      );
+
+  /*!
+  *   \brief Returns a list of the selected variables after performing the stepwise regression; the explanatory variables are passed as a strided matrix view.
+  *   \note This function is identical to NDK_PCR_STEPWISE(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_STEPWISE(), NDK_PCR_PARAM_VIEW(), NDK_PCR_PRFTest_VIEW()
+  */
+  int __stdcall	NDK_PCR_STEPWISE_VIEW (const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                      LPBYTE mask,          ///< [inout] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included.
+                                      size_t nMaskLen,      ///< [in] is the number of elements in mask
+                                      double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                      size_t nYSize,        ///< [in] is the number of elements in Y
+                                      double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                      double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha)
+                                      WORD nMode            ///< [in] is a switch to select the variable's inclusion/exclusion approach (1=forward selection (default), 2=backward elimination, 3=bi-directional elimination).
+                                      );
+
+  /*!
+  *   \brief Computes (and caches) the principal component decomposition of a data matrix, with a full or a truncated (randomized or Lanczos) backend.
+  *   \note 1. The truncated backends work on the centred (or standardized) data matrix directly, without forming the covariance matrix, 
+  *            and only compute the leading nRank components (e.g. the top 20 to 50 of 5,000 variables).
+  *   \note 2. The products with the data matrix are computed in blocks of rows, in parallel (up to nThreads workers).
+  *   \note 3. The decomposition (means, scales, singular values, loadings, and the scores U of the nXSize observations on the leading components) is kept in the handle 
+  *            and reused by NDK_PCA_MODEL_VAR(), NDK_PCR_MODEL_PARAM(), NDK_PCR_MODEL_FORE() and NDK_PCR_MODEL_FITTED(), so X is decomposed once for any number of calls 
+  *            (e.g. for several response variables). The fitted values, the regressions and the leverage measures only need the scores, 
+  *            but the residuals of NDK_PCA_MODEL_VAR() (retType=4) are computed from X, which is referenced, not copied: 
+  *            the caller's X must stay alive and unchanged until NDK_PCA_CLEANUP(). The handle holds \f$O((nXSize+nXVars) \times nRank)\f$ values.
+  *   \note 4. With the full backend, the results are identical to those of NDK_PCA_VAR() and NDK_PCR_XXX() for the same input.
+  *   \note 5. The decomposition is released by NDK_PCA_CLEANUP().
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCA_VAR(), NDK_PCR_PARAM(), NDK_PCA_MODEL_VAR(), NDK_PCR_MODEL_PARAM(), NDK_PCR_MODEL_FORE(), NDK_PCR_MODEL_FITTED(), NDK_PCA_CLEANUP()
+  */
+  int __stdcall	NDK_PCA_INIT (double** X,                   ///< [in] is the independent variables data matrix, such that each column represents one variable
+                              size_t nXSize,                ///< [in] is the number of observations (i.e. rows) in X
+                              size_t nXVars,                ///< [in] is the number of variables (i.e. columns) in X
+                              LPBYTE mask,                  ///< [in] is the boolean array to select a subset of the input variables in X. If missing (i.e. NULL), all variables in X are included. 
+                              size_t nMaskLen,              ///< [in] is the number of elements in mask
+                              WORD standardize,             ///< [in] is a flag or switch to standardize the input variables prior to the analysis (1 = standardize, 2 = subtract mean).
+                              const PCA_OPTIONS* pOptions,  ///< [in] is the backend, target rank and threading options (see #PCA_OPTIONS). If NULL, the full backend is used.
+                              NDK_HANDLE* pHandle           ///< [out] is the handle of the created decomposition.
+                              );
+
+  /*!
+  *   \brief Returns the communality, loadings, fitted values or residuals of the i-th input variable from a cached decomposition.
+  *   \note The number of principal components (wMaxPC) may not exceed the target rank of the decomposition.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCA_VAR(), NDK_PCA_INIT()
+  */
+  int __stdcall	NDK_PCA_MODEL_VAR ( NDK_HANDLE hModel,  ///< [in] is the handle of the decomposition (see NDK_PCA_INIT()).
+                                    WORD nVarIndex,     ///< [in] is  the input variable number
+                                    WORD wMaxPC,        ///< [in] is the number of principal components (PC) to include
+                                    WORD retType,       ///< [in] is a switch to select the return output (1 = final communality, 2 = loading/weights, 3 = fitted values, 4 = residuals).
+                                    double* retVal,     ///< [out] is the calculated value or data
+                                    size_t nOutSize     ///< [in] is the size of retVal
+                                    );
+
+  /*!
+  *   \brief Calculates the principal component regression coefficients values from a cached decomposition.
+  *   \note The regression uses the principal components of the decomposition (up to its target rank).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_PARAM(), NDK_PCA_INIT()
+  */
+  int __stdcall	NDK_PCR_MODEL_PARAM ( NDK_HANDLE hModel,  ///< [in] is the handle of the decomposition (see NDK_PCA_INIT()).
+                                      double* Y,          ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                      size_t nYSize,      ///< [in] is the number of elements in Y
+                                      double intercept,   ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                      double alpha,       ///< [in] is the statistical significance of the test (i.e. alpha)
+                                      WORD nRetType,      ///< [in] is a switch to select the return output (1 = value (default), 2 = std. error, 3 = t-stat, 4 = P-value, 5 = upper limit (CI), 6 = lower limit (CI)).
+                                      WORD nParamIndex,   ///< [in] is a switch to designate the target parameter (0 = intercept (default), 1 = first variable, 2 = 2nd variable, etc.). 
+                                      double* retVal      ///< [out] is the calculated parameter value or statistics.
+                                      );
+
+  /*!
+  *   \brief Calculates the principal component regression forecast value, std. error and confidence interval from a cached decomposition.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_FORE(), NDK_PCA_INIT()
+  */
+  int __stdcall	NDK_PCR_MODEL_FORE (NDK_HANDLE hModel,    ///< [in] is the handle of the decomposition (see NDK_PCA_INIT()).
+                                    double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nYSize,        ///< [in] is the number of elements in Y 
+                                    double intercept,     ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                    double* target,       ///< [in] is the value of the explanatory variables (a one dimensional array) 
+                                    double alpha,         ///< [in] is the statistical significance of the test (i.e. alpha)
+                                    WORD nRetType,        ///< [in] is a switch to select the return output (1 = forecast (default), 2 = error, 3 = upper limit, 4 = lower limit). 
+                                    double* retVal        ///< [out] is the calculated forecast value or statistics.  
+                                    );
+
+  /*!
+  *   \brief Returns the principal component regression fitted values, residuals or leverage measures from a cached decomposition.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCR_FITTED(), NDK_PCA_INIT()
+  */
+  int __stdcall	NDK_PCR_MODEL_FITTED (NDK_HANDLE hModel,  ///< [in] is the handle of the decomposition (see NDK_PCA_INIT()).
+                                      double* Y,          ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                      size_t nYSize,      ///< [in] is the number of elements in Y 
+                                      double intercept,   ///< [in] is the constant or the intercept value to fix (e.g. zero). If missing (NaN), an intercept will not be fixed and is computed normally
+                                      WORD nRetType,      ///< [in] is a switch to select the return output (1 = fitted values (default), 2 = residuals, 3 = standardized residuals, 4 = leverage (H), 5 = Cook's distance).
+                                      double* retVals,    ///< [out] is the calculated values (an array of nYSize elements).
+                                      size_t nOutSize     ///< [in] is the number of elements in retVals.
+                                      );
+
+  /*!
+  *   \brief Releases a principal component decomposition, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_PCA_INIT()
+  */
+  int __stdcall	NDK_PCA_CLEANUP (NDK_HANDLE hModel  ///< [in] is the handle of the decomposition (see NDK_PCA_INIT()).
+                                 );
+#endif // NDK_PREVIEW_API
   ///@}
 
 
@@ -2707,6 +4517,83 @@ extern "C"
                                                 ///       5. Complementary log-log
                                 WORD retType    ///< [in]  is a switch to select a output type ( see \ref #FIT_RETVAL_FUNC)
                                 );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  * \brief Computes the goodness of fit function of the GLM model; the explanatory variables are passed as a strided matrix view.
+  * \note 1. This function is identical to NDK_GLM_GOF(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of rows in X must be equal to nSize, and the number of columns in X is the number of explanatory variables.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GLM_GOF(), NDK_GLM_RESID_VIEW(), NDK_GLM_PARAM_VIEW(), NDK_GLM_FITTED_VIEW()
+  */
+  int __stdcall NDK_GLM_GOF_VIEW( double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                  size_t nSize,         ///< [in] is the number of observations
+                                  const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                  double* betas,        ///< [in] are the coefficients of the GLM model (a one dimensional array)
+                                  size_t nBetas,        ///< [in] is the number of the coefficients in betas. Note that nBetas must be equal to X->nCols+1
+                                  double  phi,          ///< [in] is the GLM dispersion paramter (see NDK_GLM_GOF()).
+                                  WORD  Lvk,            ///< [in] is the link function that describes how the mean depends on the linear predictor (see #GLM_LINK_FUNC).
+                                  WORD retType,         ///< [in] is a switch to select a fitness measure ( see \ref #GOODNESS_OF_FIT_FUNC)
+                                  double* retVal        ///< [out] is the calculated goodness of fit measure.
+                                  );
+
+  /*!
+  * \brief Returns the standardized residuals/errors of a given GLM; the explanatory variables are passed as a strided matrix view.
+  * \note This function is identical to NDK_GLM_RESID(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GLM_RESID(), NDK_GLM_GOF_VIEW(), NDK_GLM_PARAM_VIEW(), NDK_GLM_FITTED_VIEW()
+  */
+  int __stdcall NDK_GLM_RESID_VIEW( double* Y,            ///< [inout] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nSize,         ///< [in] is the number of observations
+                                    const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    double* betas,        ///< [in] are the coefficients of the GLM model (a one dimensional array)
+                                    size_t nBetas,        ///< [in] is the number of the coefficients in betas. Note that nBetas must be equal to X->nCols+1
+                                    double  phi,          ///< [in] is the GLM dispersion paramter (see NDK_GLM_GOF()).
+                                    WORD  Lvk,            ///< [in] is the link function that describes how the mean depends on the linear predictor (see #GLM_LINK_FUNC).
+                                    WORD retType          ///< [in] is a switch to select a residuals-type:raw or standardized. see \ref #RESID_RETVAL_FUNC
+                                    );
+
+  /*!
+  * \brief Returns the initial (non-optimal), optimal or standard errors of the model's parameters; the explanatory variables are passed as a strided matrix view.
+  * \note This function is identical to NDK_GLM_PARAM(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GLM_PARAM(), NDK_GLM_GOF_VIEW(), NDK_GLM_RESID_VIEW(), NDK_GLM_FITTED_VIEW()
+  */
+  int __stdcall NDK_GLM_PARAM_VIEW( double* Y,            ///< [in] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nSize,         ///< [in] is the number of observations
+                                    const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    double* betas,        ///< [inout] are the coefficients of the GLM model (a one dimensional array)
+                                    size_t nBetas,        ///< [in] is the number of the coefficients in betas. Note that nBetas must be equal to X->nCols+1
+                                    double* phi,          ///< [inout] is the GLM dispersion paramter (see NDK_GLM_PARAM()).
+                                    WORD  Lvk,            ///< [in] is the link function that describes how the mean depends on the linear predictor (see #GLM_LINK_FUNC).
+                                    WORD retType,         ///< [in] is a switch to select the type of value returned: 1= Quick Guess, 2=Calibrated, 3= Std. Errors ( see \ref #MODEL_RETVAL_FUNC)
+                                    size_t maxIter        ///< [in] is the maximum number of iterations used to calibrate the model. If missing, the default maximum of 100 is assumed.
+                                    );
+
+  /*!
+  * \brief Returns the in-sample fitted values of a given GLM; the explanatory variables are passed as a strided matrix view.
+  * \note This function is identical to NDK_GLM_FITTED(), except that X is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_GLM_FITTED(), NDK_GLM_GOF_VIEW(), NDK_GLM_RESID_VIEW(), NDK_GLM_PARAM_VIEW()
+  */
+  int __stdcall NDK_GLM_FITTED_VIEW(double* Y,            ///< [inout] is the response or the dependent variable data array (one dimensional array)
+                                    size_t nSize,         ///< [in] is the number of observations
+                                    const MATRIX_VIEW* X, ///< [in] is the strided view of the independent variables data matrix, such that each column represents one variable
+                                    double* betas,        ///< [in] are the coefficients of the GLM model (a one dimensional array)
+                                    size_t nBetas,        ///< [in] is the number of the coefficients in betas. Note that nBetas must be equal to X->nCols+1
+                                    double  phi,          ///< [in] is the GLM dispersion paramter (see NDK_GLM_FITTED()).
+                                    WORD  Lvk,            ///< [in] is the link function that describes how the mean depends on the linear predictor (see #GLM_LINK_FUNC).
+                                    WORD retType          ///< [in] is a switch to select a output type ( see \ref #FIT_RETVAL_FUNC)
+                                    );
+#endif // NDK_PREVIEW_API
   ///@}
 
   /// \name ARMA
@@ -3534,6 +5421,64 @@ extern "C"
                                       double  theta,    ///< [in] is the coefficient of first-lagged innovation (see model description).
                                       double  theta2    ///< [in] is the coefficient of s-lagged innovation (see model description).
                                         );
+
+#ifdef NDK_PREVIEW_API
+  /*!
+  * \brief Computes the conditional (CSS) log-likelihood of the AirLine model and (optionally) its gradient with respect to the model's parameters.
+  *
+  * \note 1. The time series is homogeneous or equally spaced.
+  * \note 2. The time series may include missing values (e.g. NaN) at either end.
+  * \note 3. The likelihood is conditional on zero pre-sample innovations (conditional sum of squares, CSS); it is not the exact likelihood, and the two differ by the start-up terms.
+  * \note 4. The differenced series \f$(1-L)(1-L^s)x_t\f$ follows a pure MA process with only three non-zero taps (lags 1, s and s+1): \f$(1-\theta L)(1-\Theta L^s)\f$.
+  *          Under the CSS conditioning, the residuals recursion only visits those taps, instead of the full seasonal polynomial product used by the general SARIMA path.
+  * \note 5. The gradient is computed in the same pass (forward-mode derivatives of the residuals recursion), and is returned in the following order: \f$(\mu, \sigma, \theta, \Theta)\f$.
+  * \note 6. For short time series, the value may differ from the log-likelihood reported by NDK_AIRLINE_GOF().
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_AIRLINE_GOF(), NDK_AIRLINE_PARAM(), NDK_AIRLINE_PARAM_BATCH()
+  */
+  int __stdcall NDK_AIRLINE_LLF(double* pData,    ///< [in] is the univariate time series data (a one dimensional array).
+                                size_t nSize,     ///< [in] is the number of observations in X.
+                                double mean,      ///< [in] is the model mean (i.e. \f$\mu\f$).
+                                double sigma,     ///< [in] is the standard deviation (\f$\sigma\f$) of the model's residuals/innovations.
+                                WORD    S,        ///< [in] is the length of seasonality (expressed in terms of lags, where s > 1).
+                                double  theta,    ///< [in] is the coefficient of first-lagged innovation (\f$\theta\f$)(see model description).
+                                double  theta2,   ///< [in] is the coefficient of s-lagged innovation (\f$\Theta\f$) (see model description).
+                                double* llf,      ///< [out] is the calculated log-likelihood value.
+                                double* grad      ///< [out, optional] is the gradient of the log-likelihood (an array of 4 elements). If NULL, the gradient is not computed.
+                                );
+
+  /*!
+  * \brief Returns the quick guess, optimal (calibrated) or std. errors of the AirLine model's parameters for many time series in one call.
+  *
+  * \note 1. Every time series is homogeneous or equally spaced, and may include missing values (e.g. NaN) at either end.
+  * \note 2. The time series may have different lengths, but share the same season length (S).
+  * \note 3. The time series are calibrated independently and in parallel (up to nThreads workers).
+  * \note 4. On input, means, sigmas, thetas and theta2s hold the initial values (or NaN to use the quick guess); on output, they hold the values selected by retType.
+  * \note 5. A time series that fails to calibrate (e.g. fewer than S+2 non-missing observations, or the optimizer fails) does not stop the others: 
+  *          its entries in means, sigmas, thetas and theta2s are set to NaN, and its error code is stored in pStatus.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful for one or more time series (see pStatus and \ref SFMacros.h)
+  *   \sa NDK_AIRLINE_PARAM(), NDK_AIRLINE_LLF()
+  */
+  int __stdcall NDK_AIRLINE_PARAM_BATCH(double** pData,           ///< [in] is the array of univariate time series data (one column per time series).
+                                        const size_t* nSizes,     ///< [in] is the number of observations in each time series (an array of nSeries elements).
+                                        size_t nSeries,           ///< [in] is the number of time series.
+                                        WORD    S,                ///< [in] is the length of seasonality (expressed in terms of lags, where s > 1).
+                                        double* means,            ///< [inout] is the model mean (i.e. mu) of each time series (an array of nSeries elements).
+                                        double* sigmas,           ///< [inout] is the standard deviation of the model's residuals/innovations of each time series (an array of nSeries elements).
+                                        double* thetas,           ///< [inout] is the coefficient of first-lagged innovation of each time series (an array of nSeries elements).
+                                        double* theta2s,          ///< [inout] is the coefficient of s-lagged innovation of each time series (an array of nSeries elements).
+                                        MODEL_RETVAL_FUNC retType,///< [in] is a switch to select the type of value returned: 1= Quick Guess, 2=Calibrated, 3= Std. Errors ( see \ref #MODEL_RETVAL_FUNC).
+                                        size_t maxIter,           ///< [in] is the maximum number of iterations used to calibrate each model. If missing or less than 100, the default maximum of 100 is assumed.
+                                        size_t nThreads,          ///< [in] is the maximum number of worker threads (0 = one per logical processor).
+                                        int* pStatus              ///< [out, optional] is the status code of each time series (an array of nSeries elements). If NULL, it is not returned.
+                                        );
+#endif // NDK_PREVIEW_API
   ///@}
 
   /// \name X12-ARIMA
@@ -4084,6 +6029,170 @@ extern "C"
                                 double* retVal      ///< [out] is the simulated value.
                                 );
 
+#ifdef NDK_PREVIEW_API
+  /*!
+  * \brief Computes the goodness of fit functions of the SARIMA-X model; the exogenous factors are passed as a strided matrix view.
+  *
+  * \note 1. This function is identical to NDK_SARIMAX_GOF(), except that pFactors is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of exogenous factors is taken from pFactors->nCols, and pFactors->nRows must be at least nSize.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SARIMAX_GOF(), NDK_SARIMAX_FITTED_VIEW(), NDK_SARIMAX_PARAM_VIEW(), NDK_SARIMAX_FORE_VIEW(), NDK_SARIMAX_SIM_VIEW()
+  */
+  int __stdcall NDK_SARIMAX_GOF_VIEW( double*  pData,               ///< [in] is the response univariate time series data (a one dimensional array).
+                                      size_t nSize,                 ///< [in] is the number of observations.
+                                      const MATRIX_VIEW* pFactors,  ///< [in] is the strided view of the exogneous factors time series data (each column is a separate factor, and each row is an observation).
+                                      double*  fBetas,              ///< [in] is the weights or loading of the exogneous factors.
+                                      double   mean,                ///< [in] is the ARIMA/SARIMA model's long-run mean/trend (i.e. mu). If missing (i.e. NaN), then it is assumed zero.
+                                      double sigma,                 ///< [in] is the standard deviation of the model's residuals/innovations.
+                                      WORD nIntegral,               ///< [in] is the non-seasonal difference order.
+                                      double* phis,                 ///< [in] are the coefficients's values of the non-seasonal AR component.
+                                      size_t p,                     ///< [in] is the order of the non-seasonal AR component.
+                                      double* thetas,               ///< [in] are the coefficients's values of the non-seasonal MA component.
+                                      size_t q,                     ///< [in] is the order of the non-seasonal MA component.
+                                      WORD nSIntegral,              ///< [in] is the seasonal difference.
+                                      WORD nSPeriod,                ///< [in] is the number of observations per one period (e.g. 12=Annual, 4=Quarter).
+                                      double* sPhis,                ///< [in] are the coefficients's values of the seasonal AR component.
+                                      size_t sP,                    ///< [in] is the order of the seasonal AR component.
+                                      double* sThetas,              ///< [in] are the coefficients's values of the seasonal MA component.
+                                      size_t sQ,                    ///< [in] is the order of the seasonal MA component.
+                                      GOODNESS_OF_FIT_FUNC retType, ///< [in] is a switch to select a fitness measure ( see \ref #GOODNESS_OF_FIT_FUNC).
+                                      double* retVal                ///< [out] is the calculated goodness of fit value.
+                                      );
+
+  /*!
+  * \brief Returns the in-sample model fitted values; the exogenous factors are passed as a strided matrix view.
+  *
+  * \note 1. This function is identical to NDK_SARIMAX_FITTED(), except that pFactors is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of exogenous factors is taken from pFactors->nCols, and pFactors->nRows must be at least nSize.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SARIMAX_FITTED(), NDK_SARIMAX_GOF_VIEW(), NDK_SARIMAX_PARAM_VIEW(), NDK_SARIMAX_FORE_VIEW(), NDK_SARIMAX_SIM_VIEW()
+  */
+  int __stdcall NDK_SARIMAX_FITTED_VIEW(double* pData,                ///< [inout] is the univariate time series data (a one dimensional array).
+                                        size_t nSize,                 ///< [in] is the number of observations.
+                                        const MATRIX_VIEW* pFactors,  ///< [in] is the strided view of the exogneous factors time series data (each column is a separate factor, and each row is an observation).
+                                        double*  fBetas,              ///< [in] is the weights or loading of the exogneous factors.
+                                        double   mean,                ///< [in] is the ARIMA/SARIMA model's long-run mean/trend (i.e. mu). If missing (i.e. NaN), then it is assumed zero.
+                                        double sigma,                 ///< [in] is the standard deviation of the model's residuals/innovations.
+                                        WORD nIntegral,               ///< [in] is the non-seasonal difference order.
+                                        double* phis,                 ///< [in] are the coefficients's values of the non-seasonal AR component.
+                                        size_t p,                     ///< [in] is the order of the non-seasonal AR component.
+                                        double* thetas,               ///< [in] are the coefficients's values of the non-seasonal MA component.
+                                        size_t q,                     ///< [in] is the order of the non-seasonal MA component.
+                                        WORD nSIntegral,              ///< [in] is the seasonal difference.
+                                        WORD nSPeriod,                ///< [in] is the number of observations per one period (e.g. 12=Annual, 4=Quarter).
+                                        double* sPhis,                ///< [in] are the coefficients's values of the seasonal AR component.
+                                        size_t sP,                    ///< [in] is the order of the seasonal AR component.
+                                        double* sThetas,              ///< [in] are the coefficients's values of the seasonal MA component.
+                                        size_t sQ,                    ///< [in] is the order of the seasonal MA component.
+                                        FIT_RETVAL_FUNC retType       ///< [in] is a switch to select a output type ( see \ref #FIT_RETVAL_FUNC).
+                                        );
+
+  /*!
+  * \brief Returns the quick guess, optimal (calibrated) or std. errors of the values of model's parameters; the exogenous factors are passed as a strided matrix view.
+  *
+  * \note 1. This function is identical to NDK_SARIMAX_PARAM(), except that pFactors is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of exogenous factors is taken from pFactors->nCols, and pFactors->nRows must be at least nSize.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SARIMAX_PARAM(), NDK_SARIMAX_GOF_VIEW(), NDK_SARIMAX_FITTED_VIEW(), NDK_SARIMAX_FORE_VIEW(), NDK_SARIMAX_SIM_VIEW()
+  */
+  int __stdcall NDK_SARIMAX_PARAM_VIEW( double* pData,                ///< [inout] is the univariate time series data (a one dimensional array).
+                                        size_t nSize,                 ///< [in] is the number of observations.
+                                        const MATRIX_VIEW* pFactors,  ///< [in] is the strided view of the exogneous factors time series data (each column is a separate factor, and each row is an observation).
+                                        double*  fBetas,              ///< [inout] is the weights or loading of the exogneous factors.
+                                        double* mean,                 ///< [inout] is the mean of the differenced time series process.
+                                        double* sigma,                ///< [inout] is the standard deviation of the model's residuals/innovations.
+                                        WORD nIntegral,               ///< [in] is the non-seasonal difference order.
+                                        double* phis,                 ///< [inout] are the coefficients's values of the non-seasonal AR component.
+                                        size_t p,                     ///< [in] is the order of the non-seasonal AR component.
+                                        double* thetas,               ///< [inout] are the coefficients's values of the non-seasonal MA component.
+                                        size_t q,                     ///< [in] is the order of the non-seasonal MA component.
+                                        WORD nSIntegral,              ///< [in] is the seasonal difference.
+                                        WORD nSPeriod,                ///< [in] is the number of observations per one period (e.g. 12=Annual, 4=Quarter).
+                                        double* sPhis,                ///< [inout] are the coefficients's values of the seasonal AR component.
+                                        size_t sP,                    ///< [in] is the order of the seasonal AR component.
+                                        double* sThetas,              ///< [inout] are the coefficients's values of the seasonal MA component.
+                                        size_t sQ,                    ///< [in] is the order of the seasonal MA component.
+                                        MODEL_RETVAL_FUNC retType,    ///< [in] is a switch to select the type of value returned: 1= Quick Guess, 2=Calibrated, 3= Std. Errors ( see \ref #MODEL_RETVAL_FUNC).
+                                        size_t maxIter                ///< [in] is the maximum number of iterations used to calibrate the model. If missing or less than 100, the default maximum of 100 is assumed.
+                                        );
+
+  /*!
+  * \brief Calculates the out-of-sample forecast statistics; the exogenous factors are passed as a strided matrix view.
+  *
+  * \note 1. This function is identical to NDK_SARIMAX_FORE(), except that pFactors is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of exogenous factors is taken from pFactors->nCols, and pFactors->nRows must be at least nSize+nStep.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SARIMAX_FORE(), NDK_SARIMAX_GOF_VIEW(), NDK_SARIMAX_FITTED_VIEW(), NDK_SARIMAX_PARAM_VIEW(), NDK_SARIMAX_SIM_VIEW()
+  */
+  int __stdcall NDK_SARIMAX_FORE_VIEW(double* pData,                ///< [in] is the univariate time series data (a one dimensional array).
+                                      size_t  nSize,                ///< [in] is the number of observations.
+                                      const MATRIX_VIEW* pFactors,  ///< [in] is the strided view of the exogneous factors time series data (each column is a separate factor, and each row is an observation).
+                                      double* fBetas,               ///< [in] is the weights or loading of the exogneous factors.
+                                      double  mean,                 ///< [in] is the mean of the ARMA process.
+                                      double sigma,                 ///< [in] is the standard deviation of the model's residuals/innovations.
+                                      WORD nIntegral,               ///< [in] is the non-seasonal difference order.
+                                      double* phis,                 ///< [in] are the coefficients's values of the non-seasonal AR component.
+                                      size_t p,                     ///< [in] is the order of the non-seasonal AR component.
+                                      double* thetas,               ///< [in] are the coefficients's values of the non-seasonal MA component.
+                                      size_t q,                     ///< [in] is the order of the non-seasonal MA component.
+                                      WORD nSIntegral,              ///< [in] is the seasonal difference.
+                                      WORD nSPeriod,                ///< [in] is the number of observations per one period (e.g. 12=Annual, 4=Quarter).
+                                      double* sPhis,                ///< [in] are the coefficients's values of the seasonal AR component.
+                                      size_t sP,                    ///< [in] is the order of the seasonal AR component.
+                                      double* sThetas,              ///< [in] are the coefficients's values of the seasonal MA component.
+                                      size_t sQ,                    ///< [in] is the order of the seasonal MA component.
+                                      size_t nStep,                 ///< [in] is the forecast time/horizon (expressed in terms of steps beyond end of the time series).
+                                      FORECAST_RETVAL_FUNC retType, ///< [in] is a switch to select the type of value returned (see \ref #FORECAST_RETVAL_FUNC).
+                                      double  alpha,                ///< [in] is the statistical significance level. If missing, a default of 5% is assumed.
+                                      double* retVal                ///< [out] is the calculated forecast value.
+                                      );
+
+  /*!
+  * \brief Calculates the out-of-sample simulated values; the exogenous factors are passed as a strided matrix view.
+  *
+  * \note 1. This function is identical to NDK_SARIMAX_SIM(), except that pFactors is a #MATRIX_VIEW over the caller's buffer (no copy is made).
+  * \note 2. The number of exogenous factors is taken from pFactors->nCols, and pFactors->nRows must be at least nSize+nStep.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_SARIMAX_SIM(), NDK_SARIMAX_GOF_VIEW(), NDK_SARIMAX_FITTED_VIEW(), NDK_SARIMAX_PARAM_VIEW(), NDK_SARIMAX_FORE_VIEW()
+  */
+  int __stdcall NDK_SARIMAX_SIM_VIEW( double* fBetas,               ///< [in] is the weights or loading of the exogneous factors.
+                                      double  mean,                 ///< [in] is the mean of the ARMA process.
+                                      double sigma,                 ///< [in] is the standard deviation of the model's residuals/innovations.
+                                      WORD nIntegral,               ///< [in] is the non-seasonal difference order.
+                                      double* phis,                 ///< [in] are the coefficients's values of the non-seasonal AR component.
+                                      size_t p,                     ///< [in] is the order of the non-seasonal AR component.
+                                      double* thetas,               ///< [in] are the coefficients's values of the non-seasonal MA component.
+                                      size_t q,                     ///< [in] is the order of the non-seasonal MA component.
+                                      WORD nSIntegral,              ///< [in] is the seasonal difference.
+                                      WORD nSPeriod,                ///< [in] is the number of observations per one period (e.g. 12=Annual, 4=Quarter).
+                                      double* sPhis,                ///< [in] are the coefficients's values of the seasonal AR component.
+                                      size_t sP,                    ///< [in] is the order of the seasonal AR component.
+                                      double* sThetas,              ///< [in] are the coefficients's values of the seasonal MA component.
+                                      size_t sQ,                    ///< [in] is the order of the seasonal MA component.
+                                      double* pData,                ///< [in] is the univariate time series data (a one dimensional array).
+                                      size_t nSize,                 ///< [in] is the number of observations in pData.
+                                      const MATRIX_VIEW* pFactors,  ///< [in] is the strided view of the past and future exogneous factors time series data (each column is a separate factor, and each row is an observation).
+                                      UINT nSeed,                   ///< [in] is an unsigned integer for setting up the random number generators.
+                                      size_t nStep,                 ///< [in] is the simulation time/horizon (expressed in terms of steps beyond end of the time series).
+                                      double* retVal                ///< [out] is the simulated value.
+                                      );
+#endif // NDK_PREVIEW_API
+
 
   ///@}
 
@@ -4827,6 +6936,49 @@ extern "C"
   ///@}
 
 
+#ifdef NDK_PREVIEW_API
+  /// \name Backtesting
+  /// Rolling-origin (walk-forward) evaluation of the ARMA/GARCH model families
+  /// @{
+
+  /*!
+  * \brief Runs a rolling-origin backtest: calibrates the model at every forecast origin, forecasts nHorizon steps ahead and scores the forecasts against the eventual outcomes.
+  *
+  * \note 1. The time series is homogeneous or equally spaced.
+  * \note 2. The first origin is at observation nWindow; the following origins are nStride observations apart. The number of origins is \f$1+\lfloor (N-nWindow-1)/nStride \rfloor\f$.
+  * \note 3. The model is calibrated at every nRefit-th origin. When bWarmStart is TRUE, the calibration starts from the parameters of the previous calibration instead of the quick guess.
+  * \note 4. The origins depend on each other only through the calibrated parameters, so the origins that share a calibration are evaluated in parallel (up to nThreads workers).
+  *          Without warm start, the calibrations are independent and run in parallel too. With bWarmStart, every calibration waits for the previous one; 
+  *          in particular, bWarmStart with nRefit=1 turns the calibrations into a sequential chain, and only the forecasting and scoring steps run in parallel.
+  * \note 5. For an origin with fewer than nHorizon eventual outcomes, the error measures are computed using the available outcomes only.
+  * \note 6. The scaled and relative error measures (e.g. MASE, MRAE) use nSPeriod as the seasonal period (1 if nSPeriod is zero).
+  * \note 7. ARMA, ARIMA, SARIMA and Airline: the mean forecasts (FORECAST_MEAN) are scored against the eventual observations.
+  * \note 8. GARCH, EGARCH and GARCH-M: the conditional variance forecasts (the square of FORECAST_STDEV) are scored against the squared returns, 
+  *          \f$(x_{T+h}-\mu)^2\f$, where \f$\mu\f$ is the mean calibrated at the origin (the conditional mean for GARCH-M). pForecasts holds the variance forecasts.
+  *          The squared returns are a noisy volatility proxy and are often zero, so prefer the absolute or squared error measures (e.g. RMSE, MAE) over the percentage and relative ones.
+  * \note 9. The results are identical to calibrating the model (its PARAM function) at every nRefit-th origin (from the previous parameters when bWarmStart), 
+  *          and forecasting (its FORE function) at every origin with the latest calibrated parameters, followed by the error functions (e.g. NDK_RMSE(), NDK_MASE()) 
+  *          on the series described above.
+  *
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_LENGTH_ERROR The output buffers are not big enough; nOrigins is set to the required number of origins.
+  *   \retval #NDK_FAILED operation is unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_ARIMA_PARAM(), NDK_ARIMA_FORE(), NDK_GARCH_PARAM(), NDK_GARCH_FORE(), NDK_RMSE(), NDK_MASE()
+  */
+  int __stdcall NDK_BACKTEST( double* pData,                    ///< [in] is the univariate time series data (a one dimensional array).
+                              size_t nSize,                     ///< [in] is the number of observations in pData.
+                              const BACKTEST_OPTIONS* pOptions, ///< [in] is the model, window and calibration options (see #BACKTEST_OPTIONS).
+                              const WORD* metrics,              ///< [in] is an array of the forecast error measures to compute at every origin (see #FORECAST_ERROR_FUNC).
+                              size_t nMetrics,                  ///< [in] is the number of elements in metrics.
+                              double* pErrors,                  ///< [out] is the per-origin error matrix (nOrigins rows by nMetrics columns, row-major).
+                              double* pForecasts,               ///< [out, optional] is the per-origin forecast matrix (nOrigins rows by nHorizon columns, row-major). If NULL, the forecasts are not returned.
+                              size_t* nOrigins                  ///< [inout] is the number of rows available in the output buffers on input, and the number of origins on output.
+                              );
+  ///@}
+#endif // NDK_PREVIEW_API
+
+
   /// \name Speactral Analysis
   /// @{
   /*! 
@@ -4973,6 +7125,54 @@ extern "C"
                                 size_t Nyvals   ///< [in] is the number of elements in YVals (must equal to Nxt).
                                 );
 
+#ifdef NDK_PREVIEW_API
+  /*! 
+  *   \brief Creates an interpolator: the (x,y) data table and the interpolation coefficients (e.g. cubic spline) are computed once, and reused by every call to NDK_INTERPOLATOR_EVAL().
+  *   \note 1. The interpolator is released by NDK_INTERPOLATOR_CLEANUP().
+  *   \note 2. The data table is sorted by x (if needed) and copied, so the input arrays may be released after the call.
+  *   \note 3. For the cubic spline, the spline coefficients of every interval are computed once (one tridiagonal solve), and stored interval by interval.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED   Operation unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_INTERPOLATE(), NDK_INTERPOLATOR_EVAL(), NDK_INTERPOLATOR_CLEANUP()
+  */
+  int __stdcall	NDK_INTERPOLATOR_INIT(const double* X,    ///< [in] is the x-component of the input data table (a one dimensional array)
+                                      const double* Y,    ///< [in] is the y-component of the input data table (a one dimensional array)
+                                      size_t N,           ///< [in] is the number of elements in X (and Y)
+                                      WORD  nMethod,      ///< [in] is the interpolation method (1=Forward Flat, 2=Backward Flat, 3=Linear, 4=Cubic Spline). 
+                                      BOOL extrapolate,   ///< [in] sets whether or not to allow extrapolation (1=Yes, 0=No). If missing, the default is to not allow extrapolation
+                                      NDK_HANDLE* pHandle ///< [out] is the handle of the created interpolator.
+                                      );
+
+  /*! 
+  *   \brief Evaluates an interpolator at a batch of x-values.
+  *   \note 1. The values are identical to those returned by NDK_INTERPOLATE() for the same data table and method.
+  *   \note 2. If XT is sorted in ascending order, the intervals are located by a linear (merge) walk along the data table, instead of a binary search for each x-value.
+  *            The order of XT is detected on the fly, so unsorted input is still supported (with a binary search per x-value).
+  *   \note 3. The interval polynomials are evaluated with vectorized (SIMD) kernels.
+  *   \note 4. The interpolator is read-only during the evaluation, so the same handle may be evaluated by several threads at once.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED   Operation unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_INTERPOLATE(), NDK_INTERPOLATOR_INIT(), NDK_INTERPOLATOR_CLEANUP()
+  */
+  int __stdcall	NDK_INTERPOLATOR_EVAL(NDK_HANDLE hInterp,   ///< [in] is the handle of the interpolator (see NDK_INTERPOLATOR_INIT()).
+                                      const double* XT,     ///< [in] is the desired x-value(s) to interpolate for (a single value or a one dimensional array).
+                                      size_t Nxt,           ///< [in] is the number of elements in XT
+                                      double* YVals         ///< [out] is the output buffer to store the interpolated values (an array of Nxt elements).
+                                      );
+
+  /*! 
+  *   \brief Releases an interpolator, and all the resources it holds.
+  *   \return status code of the operation
+  *   \retval #NDK_SUCCESS Operation successful
+  *   \retval #NDK_FAILED   Operation unsuccessful (see \ref SFMacros.h)
+  *   \sa NDK_INTERPOLATOR_INIT()
+  */
+  int __stdcall	NDK_INTERPOLATOR_CLEANUP(NDK_HANDLE hInterp ///< [in] is the handle of the interpolator (see NDK_INTERPOLATOR_INIT()).
+                                        );
+#endif // NDK_PREVIEW_API
+
   /*! 
   *   \brief Query & retrieve NumXL SDK environment information 
   *   \return status code of the operation
@@ -8,6 +8,7 @@
 #include "SFLUC.h"
 #include "SFDBM.h"
 #include "SFSDK.h"
+#include <math.h>
 
 // passengers data of the international airline problem (Box-Jenkins 1955)
 double data[]={112,118,132,129,121,135,148,148,136,119,104,118,
@@ -31,6 +32,14 @@ int test_sesmth(void);
 int test_desmth(void);
 int test_lesmth(void);
 int test_tesmth(void);
+// the preview API (see NDK_PREVIEW_API in SFSDK.h) is not exported by the shipped SFSDK.lib yet
+#ifdef NDK_PREVIEW_API
+int test_esmth(void);
+int test_esmth_batch(void);
+int test_tesmth_series(void);
+int test_wma_panel(void);
+int test_adftest_dist(void);
+#endif
 
 
 int _tmain(int argc, _TCHAR* argv[])
@@ -113,6 +122,23 @@ int _tmain(int argc, _TCHAR* argv[])
     // test tesmth function
     test_tesmth();
 
+#ifdef NDK_PREVIEW_API
+    // test the stateful exponential smoothing model
+    test_esmth();
+
+    // test the panel optimization
+    test_esmth_batch();
+
+    // test the in-sample series and horizons 1..12 in one call
+    test_tesmth_series();
+
+    // test the full-series wma over several columns
+    test_wma_panel();
+
+    // test the unit-root distribution functions against the existing tests
+    test_adftest_dist();
+#endif
+
     nRet = NDK_Shutdown();
     if(nRet == NDK_SUCCESS)
     {
@@ -273,3 +299,319 @@ int test_tesmth(void)
 }
 
 
+#ifdef NDK_PREVIEW_API
+int test_esmth(void)
+{
+  double level[132], trend[132], seasonals[132];
+  double fore[12]={0};
+  double foreCopy[12]={0};
+  BYTE   blob[512];
+  size_t nBlobSize=sizeof(blob);
+  NDK_HANDLE hModel=NULL;
+  NDK_HANDLE hCopy=NULL;
+  int nRet=-1;
+
+  double alpha=0.333, beta=0.333, gamma=0.333, phi=1.0, lambda=0.0;
+  double retVal=0.0;
+
+  // take the state after the first 132 observations from the full recompute (additive trend and seasonality)
+  nRet = NDK_GESMTH(data, 132, true, &alpha, &beta, &gamma, &phi, &lambda, 1, 1, 12, 0, false, false, false, level, 132, 1, &retVal);
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_GESMTH(data, 132, true, &alpha, &beta, &gamma, &phi, &lambda, 1, 1, 12, 0, false, false, false, trend, 132, 2, &retVal);
+  }
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_GESMTH(data, 132, true, &alpha, &beta, &gamma, &phi, &lambda, 1, 1, 12, 0, false, false, false, seasonals, 132, 3, &retVal);
+  }
+
+  // feed the last 12 observations one at a time
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_ESMTH_INIT(alpha, beta, gamma, phi, lambda, 1 /*additive*/, 1 /*additive*/, 12, false, false, level[131], trend[131], &seasonals[120], 0.0, &hModel);
+  }
+  for(size_t i=132; (nRet == NDK_SUCCESS) && (i<144); i++)
+  {
+    nRet = NDK_ESMTH_UPDATE(hModel, &data[i], 1, NULL);
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_ESMTH_FORE(hModel, 12, fore);
+  }
+
+  // the incremental forecasts must match the full recompute over all 144 observations
+  for(int h=1; (nRet == NDK_SUCCESS) && (h<=12); h++)
+  {
+    nRet = NDK_GESMTH(data, 144, true, &alpha, &beta, &gamma, &phi, &lambda, 1, 1, 12, h, false, false, false, NULL, 0, 0, &retVal);
+    if((nRet == NDK_SUCCESS) && (fabs(retVal-fore[h-1]) > 1e-9*fabs(retVal)))
+    {
+      nRet = NDK_FAILED;
+    }
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_ESMTH_SAVE(hModel, blob, &nBlobSize);
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_ESMTH_LOAD(blob, nBlobSize, &hCopy);
+  }
+
+  // the restored model must forecast exactly as the original one
+  if(nRet == NDK_SUCCESS)
+  {
+    nRet = NDK_ESMTH_FORE(hCopy, 12, foreCopy);
+  }
+  for(size_t i=0; (nRet == NDK_SUCCESS) && (i<12); i++)
+  {
+    if(fore[i] != foreCopy[i])
+    {
+      nRet = NDK_FAILED;
+    }
+  }
+
+  if(hCopy)
+  {
+    NDK_ESMTH_CLEANUP(hCopy);
+  }
+  if(hModel)
+  {
+    NDK_ESMTH_CLEANUP(hModel);
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    std::cout  <<  "<===== (7) Passed -- NDK_ESMTH Testing =====>" << std::endl;
+  }
+  else
+  {
+    std::cout  <<  "<===== (7) Failed -- NDK_ESMTH Testing =====>" << std::endl;
+  }
+
+  return nRet;
+}
+
+
+int test_esmth_batch(void)
+{
+  // the airline data split into two series with different lengths
+  double* pData[2]={data, data+24};
+  size_t  nSizes[2]={144, 120};
+  int     L[2]={12, 12};
+  double  alphas[2]={0.333, 0.333};
+  double  betas[2]={0.333, 0.333};
+  double  gammas[2]={0.333, 0.333};
+  int     status[2]={-1, -1};
+  int nRet=-1;
+
+  nRet = NDK_ESMTH_PARAM_BATCH(pData, nSizes, 2, true, ESMTH_TRIPLE, L, alphas, betas, gammas, 0, NULL, status);
+
+  // the optimal factors themselves are not stable across optimizers (the SSE surface is flat near its minimum), 
+  // so compare the fitted values and the forecasts at the batch factors with those at the factors of NDK_TESMTH (bOptimize=TRUE)
+  for(size_t i=0; (nRet == NDK_SUCCESS) && (i<2); i++)
+  {
+    double alpha=0.333, beta=0.333, gamma=0.333;
+    double retVal=0.0;
+    double batchVals[144+12], refVals[144+12];
+
+    nRet = NDK_TESMTH(pData[i], nSizes[i], true, &alpha, &beta, &gamma, L[i], 0, true /*optimze*/, NULL, 0, 0, &retVal);
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_TESMTH_SERIES(pData[i], nSizes[i], true, &alpha, &beta, &gamma, L[i], 12, false, refVals, nSizes[i]+12);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_TESMTH_SERIES(pData[i], nSizes[i], true, &alphas[i], &betas[i], &gammas[i], L[i], 12, false, batchVals, nSizes[i]+12);
+    }
+    for(size_t k=0; (nRet == NDK_SUCCESS) && (k<nSizes[i]+12); k++)
+    {
+      if(fabs(batchVals[k]-refVals[k]) > 1e-3*fabs(refVals[k]))
+      {
+        nRet = NDK_FAILED;
+      }
+    }
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    std::cout  <<  "<===== (8) Passed -- NDK_ESMTH_PARAM_BATCH Testing =====>" << std::endl;
+  }
+  else
+  {
+    std::cout  <<  "<===== (8) Failed -- NDK_ESMTH_PARAM_BATCH Testing =====>" << std::endl;
+  }
+
+  return nRet;
+}
+
+
+int test_tesmth_series(void)
+{
+  double retVals[144+12];
+  int nRet=-1;
+
+  double alpha=0.333f;
+  double beta=0.333f;
+  double gamma=0.333f;
+  int seasonLen=12;
+
+  nRet = NDK_TESMTH_SERIES(data,144, true,&alpha,&beta,&gamma, seasonLen, 12, true /*optimze*/, retVals, 144+12);
+
+  // the forecasts must match NDK_TESMTH for each horizon (1..12), using the optimal factors returned above
+  for(int h=1; (nRet == NDK_SUCCESS) && (h<=12); h++)
+  {
+    double retVal=0.0;
+    nRet = NDK_TESMTH(data,144, true,&alpha,&beta,&gamma, seasonLen, h, false, NULL, 0, 0, &retVal);
+    if((nRet == NDK_SUCCESS) && (fabs(retVal-retVals[144+h-1]) > 1e-9*fabs(retVal)))
+    {
+      nRet = NDK_FAILED;
+    }
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    std::cout  <<  "<===== (9) Passed -- NDK_TESMTH_SERIES Testing =====>" << std::endl;
+  }
+  else
+  {
+    std::cout  <<  "<===== (9) Failed -- NDK_TESMTH_SERIES Testing =====>" << std::endl;
+  }
+
+  return nRet;
+}
+
+
+int test_wma_panel(void)
+{
+  // two columns of 144 observations each: the airline data and its time reversal
+  double reversed[144];
+  for(size_t i=0; i<144; i++)
+  {
+    reversed[i]=data[143-i];
+  }
+  double* pData[2]={data, reversed};
+
+  // a uniform window (running sums), and 96 exponentially decaying weights (FFT convolution, see NDK_WMA_SERIES())
+  double uniform[]={24};
+  double decaying[96];
+  for(size_t k=0; k<96; k++)
+  {
+    decaying[k]=exp(-(double)k/20.0);
+  }
+  double* weights[2]={uniform, decaying};
+  size_t  nwSizes[2]={1, 96};
+
+  double retVal0[144], retVal1[144];
+  double* retVals[2]={retVal0, retVal1};
+  int nRet=NDK_SUCCESS;
+
+  for(size_t w=0; (nRet == NDK_SUCCESS) && (w<2); w++)
+  {
+    nRet = NDK_WMA_PANEL(pData, 144, 2, true, weights[w], nwSizes[w], 0, retVals, 144);
+
+    // every value of each column must match NDK_WMA at the same position
+    for(size_t j=0; (nRet == NDK_SUCCESS) && (j<2); j++)
+    {
+      for(size_t i=0; (nRet == NDK_SUCCESS) && (i<144); i++)
+      {
+        double retVal=0.0;
+        if(NDK_WMA(pData[j], i+1, true, weights[w], nwSizes[w], 0, &retVal) == NDK_SUCCESS)
+        {
+          if(fabs(retVal-retVals[j][i]) > 1e-9*fabs(retVal))
+          {
+            nRet = NDK_FAILED;
+          }
+        }
+        else if(retVals[j][i] == retVals[j][i])
+        {
+          // a position NDK_WMA cannot compute (e.g. shorter than the window) must be missing (NaN)
+          nRet = NDK_FAILED;
+        }
+      }
+    }
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    std::cout  <<  "<===== (10) Passed -- NDK_WMA_PANEL Testing =====>" << std::endl;
+  }
+  else
+  {
+    std::cout  <<  "<===== (10) Failed -- NDK_WMA_PANEL Testing =====>" << std::endl;
+  }
+
+  return nRet;
+}
+
+
+int test_adftest_dist(void)
+{
+  int nRet=NDK_SUCCESS;
+
+  // ADF (no lags) and KPSS on the airline data: the p-value and critical value of the
+  // distribution functions must match the ones returned by the tests themselves
+  for(int i=0; (nRet == NDK_SUCCESS) && (i<2); i++)
+  {
+    ADFTEST_OPTION option = (i==0)? ADFTEST_DRIFT_N_CONST: ADFTEST_DRIFT_N_CONST_N_TREND;
+    double score=0.0, pValue=0.0, cv=0.0;
+    double distPValue=0.0, distCV=0.0;
+
+    nRet = NDK_ADFTEST(data, 144, 0, option, false, 0.05, 1, TEST_SCORE, &score);
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_ADFTEST(data, 144, 0, option, false, 0.05, 1, TEST_PVALUE, &pValue);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_ADFTEST(data, 144, 0, option, false, 0.05, 1, TEST_CRITICALVALUE, &cv);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      // one observation is lost to the first difference
+      nRet = NDK_ADFTEST_DIST(score, 143, option, 0.05, &distPValue, &distCV);
+    }
+    if((nRet == NDK_SUCCESS) && 
+       ((fabs(pValue-distPValue) > 1e-6) || (fabs(cv-distCV) > 1e-6*fabs(cv))))
+    {
+      nRet = NDK_FAILED;
+    }
+
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_KPSSTEST(data, 144, 0, option, false, 0, TEST_SCORE, 0.05, &score);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_KPSSTEST(data, 144, 0, option, false, 0, TEST_PVALUE, 0.05, &pValue);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_KPSSTEST(data, 144, 0, option, false, 0, TEST_CRITICALVALUE, 0.05, &cv);
+    }
+    if(nRet == NDK_SUCCESS)
+    {
+      nRet = NDK_KPSSTEST_DIST(score, 144, option, 0.05, &distPValue, &distCV);
+    }
+    if((nRet == NDK_SUCCESS) && 
+       ((fabs(pValue-distPValue) > 1e-6) || (fabs(cv-distCV) > 1e-6*fabs(cv))))
+    {
+      nRet = NDK_FAILED;
+    }
+  }
+
+  if(nRet == NDK_SUCCESS)
+  {
+    std::cout  <<  "<===== (11) Passed -- NDK_ADFTEST_DIST/NDK_KPSSTEST_DIST Testing =====>" << std::endl;
+  }
+  else
+  {
+    std::cout  <<  "<===== (11) Failed -- NDK_ADFTEST_DIST/NDK_KPSSTEST_DIST Testing =====>" << std::endl;
+  }
+
+  return nRet;
+}
+
+#endif // NDK_PREVIEW_API